@@ -2,7 +2,6 @@
 #include "WiFi.h"
 #include "time.h"
 #include "esp_sntp.h"
-#include "ESP32Ping.h"
 
 #include "config.h"
 #include "utils.h"
@@ -19,9 +18,7 @@ static PingTarget google = {.displayHostname="Google.com", .useIP=false, .fqn="w
 
 std::vector<PingTarget> pingTargets;
 
-#define MIN(x, y) (x < y) ? x : y
-
-void printText(const char *msg, uint8_t len, uint16_t fore = 0xFFFF, uint16_t back = 0x0000)
+void printText(const char *msg, uint16_t len, uint16_t fore = 0xFFFF, uint16_t back = 0x0000)
 {
   // Check that the message and message length are valid
   if (!msg || !len)
@@ -30,24 +27,15 @@ void printText(const char *msg, uint8_t len, uint16_t fore = 0xFFFF, uint16_t ba
   // Set printing colours
   M5.Lcd.setTextColor(fore, back);
 
-  // If printing the entire string, no modification is is necessary
-  if (strlen(msg) == len)
-  {
-    M5.Lcd.print(msg);
-    return;
-  }
-
-  // Otherwise, print the string.
-  // If the string is too short, pad it with spaces and if too long, truncate it
-  char buff[len + 1];
-  memset(buff, ' ', sizeof(buff));
-  memcpy(buff, msg, MIN(len, strlen(msg)));
-  buff[len] = 0;
-
-  M5.Lcd.print(buff);
+  // Print the string straight from where it is, truncated to len characters, and pad it with spaces if too short.
+  // The string may be an item's whole text, so no more than len characters are read
+  size_t n = strnlen(msg, len);
+  M5.Lcd.write((const uint8_t *)msg, n);
+  while (n++ < len)
+    M5.Lcd.write(' ');
 }
 
-void printTextInverted(const char *msg, uint8_t len, uint16_t fore = 0xFFFF, uint16_t back = 0x0000)
+void printTextInverted(const char *msg, uint16_t len, uint16_t fore = 0xFFFF, uint16_t back = 0x0000)
 {
   // Check that the message and message length are valid
   if (!msg || !len)
@@ -56,21 +44,18 @@ void printTextInverted(const char *msg, uint8_t len, uint16_t fore = 0xFFFF, uin
   // Set printing colours
   M5.Lcd.setTextColor(back, fore);
 
-  // If printing the entire string, no modification is is necessary
-  if (strlen(msg) == len)
-  {
-    M5.Lcd.print(msg);
-    return;
-  }
-
-  // Otherwise, print the string.
-  // If the string is too short, pad it with spaces and if too long, truncate it
-  char buff[len + 1];
-  memset(buff, ' ', sizeof(buff));
-  memcpy(buff, msg, MIN(len, strlen(msg)));
-  buff[len] = 0;
+  // Print the string straight from where it is, truncated to len characters, and pad it with spaces if too short.
+  // The string may be an item's whole text, so no more than len characters are read
+  size_t n = strnlen(msg, len);
+  M5.Lcd.write((const uint8_t *)msg, n);
+  while (n++ < len)
+    M5.Lcd.write(' ');
+}
 
-  M5.Lcd.print(buff);
+/// @brief Move the LCD cursor to a character cell, allowing the menu to update parts of a page in place
+void moveCursor(uint16_t col, uint16_t row)
+{
+  M5.Lcd.setCursor(col * M5.Lcd.fontWidth(), row * M5.Lcd.fontHeight());
 }
 
 /// @brief Create the menu, defining the length of the main and auxiliary texe sections
@@ -114,17 +99,21 @@ void setup()
   WiFi.setHostname(MINU_FOB_NAME);
 
   // Initialize the menu system.
+  menu.setCursorFunction(moveCursor);
   uiMenuInit();
 
-  // Set the function to be called when network time is successfully synced
+  // The time page shows the system time, which starts from the RTC until network time is synced
+  M5.Rtc.setSystemTimeFromRtc();
+
+  // Network time only requests an RTC sync, which the UI loop runs. Nothing waits in the SNTP task
   sntp_set_time_sync_notification_cb([](struct timeval *t)
                                      {
   Serial.println("Got time adjustment from NTP!");
-  syncNtpToRtc(TIMEZONE);
+  timeService.requestSync();
   });
 
   esp_sntp_servermode_dhcp(1);
-  configTime(GMT_OFFSET_SEC, DAYLIGHT_OFFSET_SEC, NTP_SERVER1, NTP_SERVER2);
+  configTzTime(TIMEZONE, NTP_SERVER1, NTP_SERVER2);
 }
 
 void loop()
@@ -27,6 +27,22 @@
 // Uncomment the following line to enable beeping on every button press
 // #define UI_BEEP
 
+/// @brief Wi-Fi channels scanned one at a time, so that results are shown as each channel completes
+#define WIFI_SCAN_CHANNELS      13
+
+/// @brief Most networks kept on the scan result page. The strongest are kept
+#define WIFI_SCAN_RESULT_MAX    20
+
+/// @brief Interval at which networks are rescanned while the scan result page is open
+#define WIFI_SCAN_REFRESH_MS    10000
+
+/// @brief Interval between pings to each reachable ping target, and time after which a ping is lost
+#define PING_INTERVAL_MS        1000
+#define PING_TIMEOUT_MS         1000
+
+/// @brief Longest the UI loop prints a frame for before handling input again. The rest of the frame follows after
+#define UI_RENDER_BUDGET_MS     10
+
 /// @brief Port used for the device's local HTTP server
 #define HTTP_PORT               80
 
@@ -34,15 +50,12 @@
 #define NTP_SERVER1             "pool.ntp.org"
 #define NTP_SERVER2             "time.nist.gov"
 
-/// @brief Offset from GMT time in seconds
-#define GMT_OFFSET_SEC          (3 * 3600)  
-
-/// @brief Daylight saving time
-#define DAYLIGHT_OFFSET_SEC     0     
-
 /// @brief Timezone definition
 #define TIMEZONE                TZ_America_Chicago
 
+/// @brief Interval at which the RTC is set to network time, or 0 to only do so when SNTP updates the system time
+#define RTC_SYNC_INTERVAL_S     0
+
 
 /// @brief Define the default text size for the menu system
 ///        This also defines the default length of the mennu item main and auxiliary text
@@ -62,4 +75,7 @@
 
 #define LONG_PRESS_THRESHOLD_MS     300
 
+/// @brief Interval at which the buttons are polled
+#define BUTTON_POLL_INTERVAL_MS     10
+
 #endif
\ No newline at end of file
@@ -0,0 +1,532 @@
+// ! ! ! DO NOT EDIT, AUTOMATICALLY GENERATED ! ! !
+// Generated from TZ.h by extras/strtab/minu_strtab_gen.cpp: 599 entries, 8291 bytes
+
+#pragma once
+
+#include "../../minu_strtab.hpp"
+
+static const uint32_t tzTableBuckets[] = {
+  0, 166, 347, 521, 726, 907, 1092, 1276, 1470, 1665, 1839, 2022,
+  2216, 2401, 2602, 2792, 2951, 3113, 3288, 3453, 3627, 3820, 4016, 4186,
+  4395, 4511, 4600, 4748, 4941, 5095, 5261, 5421, 5583, 5741, 5909, 6082,
+  6241, 6412,
+};
+
+static const uint8_t tzTableTexts[] = {
+  0x00, 0x0E, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x5F, 0x41, 0x62, 0x69, 0x64, 0x6A, 0x61, 0x6E,
+  0x00, 0x00, 0x08, 0x04, 0x63, 0x63, 0x72, 0x61, 0x00, 0x00, 0x08, 0x0A, 0x64, 0x64, 0x69, 0x73,
+  0x5F, 0x41, 0x62, 0x61, 0x62, 0x61, 0x01, 0x00, 0x08, 0x06, 0x6C, 0x67, 0x69, 0x65, 0x72, 0x73,
+  0x02, 0x00, 0x08, 0x05, 0x73, 0x6D, 0x61, 0x72, 0x61, 0x01, 0x00, 0x0A, 0x03, 0x65, 0x72, 0x61,
+  0x01, 0x00, 0x07, 0x06, 0x42, 0x61, 0x6D, 0x61, 0x6B, 0x6F, 0x00, 0x00, 0x09, 0x04, 0x6E, 0x67,
+  0x75, 0x69, 0x03, 0x00, 0x0A, 0x03, 0x6A, 0x75, 0x6C, 0x00, 0x00, 0x08, 0x05, 0x69, 0x73, 0x73,
+  0x61, 0x75, 0x00, 0x00, 0x08, 0x07, 0x6C, 0x61, 0x6E, 0x74, 0x79, 0x72, 0x65, 0x04, 0x00, 0x08,
+  0x0A, 0x72, 0x61, 0x7A, 0x7A, 0x61, 0x76, 0x69, 0x6C, 0x6C, 0x65, 0x03, 0x00, 0x08, 0x08, 0x75,
+  0x6A, 0x75, 0x6D, 0x62, 0x75, 0x72, 0x61, 0x04, 0x00, 0x07, 0x05, 0x43, 0x61, 0x69, 0x72, 0x6F,
+  0x05, 0x00, 0x09, 0x08, 0x73, 0x61, 0x62, 0x6C, 0x61, 0x6E, 0x63, 0x61, 0x06, 0x00, 0x08, 0x04,
+  0x65, 0x75, 0x74, 0x61, 0x07, 0x00, 0x00, 0x0E, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x5F, 0x43,
+  0x6F, 0x6E, 0x61, 0x6B, 0x72, 0x79, 0x00, 0x00, 0x07, 0x05, 0x44, 0x61, 0x6B, 0x61, 0x72, 0x00,
+  0x00, 0x09, 0x0B, 0x72, 0x5F, 0x65, 0x73, 0x5F, 0x53, 0x61, 0x6C, 0x61, 0x61, 0x6D, 0x01, 0x00,
+  0x08, 0x07, 0x6A, 0x69, 0x62, 0x6F, 0x75, 0x74, 0x69, 0x01, 0x00, 0x08, 0x05, 0x6F, 0x75, 0x61,
+  0x6C, 0x61, 0x03, 0x00, 0x07, 0x08, 0x45, 0x6C, 0x5F, 0x41, 0x61, 0x69, 0x75, 0x6E, 0x06, 0x00,
+  0x07, 0x08, 0x46, 0x72, 0x65, 0x65, 0x74, 0x6F, 0x77, 0x6E, 0x00, 0x00, 0x07, 0x08, 0x47, 0x61,
+  0x62, 0x6F, 0x72, 0x6F, 0x6E, 0x65, 0x04, 0x00, 0x07, 0x06, 0x48, 0x61, 0x72, 0x61, 0x72, 0x65,
+  0x04, 0x00, 0x07, 0x0C, 0x4A, 0x6F, 0x68, 0x61, 0x6E, 0x6E, 0x65, 0x73, 0x62, 0x75, 0x72, 0x67,
+  0x08, 0x00, 0x08, 0x03, 0x75, 0x62, 0x61, 0x04, 0x00, 0x07, 0x07, 0x4B, 0x61, 0x6D, 0x70, 0x61,
+  0x6C, 0x61, 0x01, 0x00, 0x08, 0x07, 0x68, 0x61, 0x72, 0x74, 0x6F, 0x75, 0x6D, 0x04, 0x00, 0x08,
+  0x05, 0x69, 0x67, 0x61, 0x6C, 0x69, 0x04, 0x00, 0x09, 0x06, 0x6E, 0x73, 0x68, 0x61, 0x73, 0x61,
+  0x03, 0x00, 0x07, 0x05, 0x4C, 0x61, 0x67, 0x6F, 0x73, 0x03, 0x00, 0x00, 0x11, 0x41, 0x66, 0x72,
+  0x69, 0x63, 0x61, 0x5F, 0x4C, 0x69, 0x62, 0x72, 0x65, 0x76, 0x69, 0x6C, 0x6C, 0x65, 0x03, 0x00,
+  0x08, 0x03, 0x6F, 0x6D, 0x65, 0x00, 0x00, 0x08, 0x05, 0x75, 0x61, 0x6E, 0x64, 0x61, 0x03, 0x00,
+  0x09, 0x08, 0x62, 0x75, 0x6D, 0x62, 0x61, 0x73, 0x68, 0x69, 0x04, 0x00, 0x09, 0x04, 0x73, 0x61,
+  0x6B, 0x61, 0x04, 0x00, 0x07, 0x06, 0x4D, 0x61, 0x6C, 0x61, 0x62, 0x6F, 0x03, 0x00, 0x09, 0x04,
+  0x70, 0x75, 0x74, 0x6F, 0x04, 0x00, 0x09, 0x04, 0x73, 0x65, 0x72, 0x75, 0x08, 0x00, 0x08, 0x06,
+  0x62, 0x61, 0x62, 0x61, 0x6E, 0x65, 0x08, 0x00, 0x08, 0x08, 0x6F, 0x67, 0x61, 0x64, 0x69, 0x73,
+  0x68, 0x75, 0x01, 0x00, 0x09, 0x06, 0x6E, 0x72, 0x6F, 0x76, 0x69, 0x61, 0x00, 0x00, 0x07, 0x07,
+  0x4E, 0x61, 0x69, 0x72, 0x6F, 0x62, 0x69, 0x01, 0x00, 0x08, 0x07, 0x64, 0x6A, 0x61, 0x6D, 0x65,
+  0x6E, 0x61, 0x03, 0x00, 0x08, 0x05, 0x69, 0x61, 0x6D, 0x65, 0x79, 0x03, 0x00, 0x08, 0x09, 0x6F,
+  0x75, 0x61, 0x6B, 0x63, 0x68, 0x6F, 0x74, 0x74, 0x00, 0x00, 0x07, 0x0B, 0x4F, 0x75, 0x61, 0x67,
+  0x61, 0x64, 0x6F, 0x75, 0x67, 0x6F, 0x75, 0x00, 0x00, 0x00, 0x11, 0x41, 0x66, 0x72, 0x69, 0x63,
+  0x61, 0x5F, 0x50, 0x6F, 0x72, 0x74, 0x6F, 0x6D, 0x4E, 0x6F, 0x76, 0x6F, 0x03, 0x00, 0x07, 0x08,
+  0x53, 0x61, 0x6F, 0x5F, 0x54, 0x6F, 0x6D, 0x65, 0x00, 0x00, 0x07, 0x08, 0x54, 0x69, 0x6D, 0x62,
+  0x75, 0x6B, 0x74, 0x75, 0x00, 0x00, 0x08, 0x06, 0x72, 0x69, 0x70, 0x6F, 0x6C, 0x69, 0x09, 0x00,
+  0x08, 0x04, 0x75, 0x6E, 0x69, 0x73, 0x02, 0x00, 0x07, 0x08, 0x57, 0x69, 0x6E, 0x64, 0x68, 0x6F,
+  0x65, 0x6B, 0x04, 0x00, 0x01, 0x0B, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x5F, 0x41, 0x64, 0x61,
+  0x6B, 0x0A, 0x00, 0x09, 0x08, 0x6E, 0x63, 0x68, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x0B, 0x00, 0x0A,
+  0x06, 0x67, 0x75, 0x69, 0x6C, 0x6C, 0x61, 0x0C, 0x00, 0x0A, 0x05, 0x74, 0x69, 0x67, 0x75, 0x61,
+  0x0C, 0x00, 0x09, 0x08, 0x72, 0x61, 0x67, 0x75, 0x61, 0x69, 0x6E, 0x61, 0x0D, 0x00, 0x0A, 0x14,
+  0x67, 0x65, 0x6E, 0x74, 0x69, 0x6E, 0x61, 0x5F, 0x42, 0x75, 0x65, 0x6E, 0x6F, 0x73, 0x5F, 0x41,
+  0x69, 0x72, 0x65, 0x73, 0x0D, 0x00, 0x12, 0x09, 0x43, 0x61, 0x74, 0x61, 0x6D, 0x61, 0x72, 0x63,
+  0x61, 0x0D, 0x00, 0x13, 0x0D, 0x6F, 0x6D, 0x6F, 0x64, 0x52, 0x69, 0x76, 0x61, 0x64, 0x61, 0x76,
+  0x69, 0x61, 0x0D, 0x00, 0x14, 0x05, 0x72, 0x64, 0x6F, 0x62, 0x61, 0x0D, 0x00, 0x12, 0x05, 0x4A,
+  0x75, 0x6A, 0x75, 0x79, 0x0D, 0x00, 0x00, 0x1A, 0x41, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x5F,
+  0x41, 0x72, 0x67, 0x65, 0x6E, 0x74, 0x69, 0x6E, 0x61, 0x5F, 0x4C, 0x61, 0x5F, 0x52, 0x69, 0x6F,
+  0x6A, 0x61, 0x0D, 0x00, 0x12, 0x07, 0x4D, 0x65, 0x6E, 0x64, 0x6F, 0x7A, 0x61, 0x0D, 0x00, 0x12,
+  0x0C, 0x52, 0x69, 0x6F, 0x5F, 0x47, 0x61, 0x6C, 0x6C, 0x65, 0x67, 0x6F, 0x73, 0x0D, 0x00, 0x12,
+  0x05, 0x53, 0x61, 0x6C, 0x74, 0x61, 0x0D, 0x00, 0x14, 0x06, 0x6E, 0x5F, 0x4A, 0x75, 0x61, 0x6E,
+  0x0D, 0x00, 0x16, 0x04, 0x4C, 0x75, 0x69, 0x73, 0x0D, 0x00, 0x12, 0x07, 0x54, 0x75, 0x63, 0x75,
+  0x6D, 0x61, 0x6E, 0x0D, 0x00, 0x12, 0x07, 0x55, 0x73, 0x68, 0x75, 0x61, 0x69, 0x61, 0x0D, 0x00,
+  0x0A, 0x03, 0x75, 0x62, 0x61, 0x0C, 0x00, 0x09, 0x07, 0x73, 0x75, 0x6E, 0x63, 0x69, 0x6F, 0x6E,
+  0x0E, 0x00, 0x09, 0x07, 0x74, 0x69, 0x6B, 0x6F, 0x6B, 0x61, 0x6E, 0x0F, 0x00, 0x0A, 0x02, 0x6B,
+  0x61, 0x0A, 0x00, 0x08, 0x05, 0x42, 0x61, 0x68, 0x69, 0x61, 0x0D, 0x00, 0x0D, 0x09, 0x5F, 0x42,
+  0x61, 0x6E, 0x64, 0x65, 0x72, 0x61, 0x73, 0x10, 0x00, 0x0A, 0x06, 0x72, 0x62, 0x61, 0x64, 0x6F,
+  0x73, 0x0C, 0x00, 0x09, 0x04, 0x65, 0x6C, 0x65, 0x6D, 0x0D, 0x00, 0x00, 0x0E, 0x41, 0x6D, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x5F, 0x42, 0x65, 0x6C, 0x69, 0x7A, 0x65, 0x10, 0x00, 0x09, 0x0B, 0x6C,
+  0x61, 0x6E, 0x63, 0x6D, 0x53, 0x61, 0x62, 0x6C, 0x6F, 0x6E, 0x0C, 0x00, 0x09, 0x08, 0x6F, 0x61,
+  0x5F, 0x56, 0x69, 0x73, 0x74, 0x61, 0x11, 0x00, 0x0A, 0x04, 0x67, 0x6F, 0x74, 0x61, 0x12, 0x00,
+  0x0A, 0x03, 0x69, 0x73, 0x65, 0x13, 0x00, 0x09, 0x0B, 0x75, 0x65, 0x6E, 0x6F, 0x73, 0x5F, 0x41,
+  0x69, 0x72, 0x65, 0x73, 0x0D, 0x00, 0x08, 0x0D, 0x43, 0x61, 0x6D, 0x62, 0x72, 0x69, 0x64, 0x67,
+  0x65, 0x5F, 0x42, 0x61, 0x79, 0x13, 0x00, 0x0B, 0x09, 0x70, 0x6F, 0x5F, 0x47, 0x72, 0x61, 0x6E,
+  0x64, 0x65, 0x11, 0x00, 0x0A, 0x04, 0x6E, 0x63, 0x75, 0x6E, 0x0F, 0x00, 0x0A, 0x05, 0x72, 0x61,
+  0x63, 0x61, 0x73, 0x11, 0x00, 0x0A, 0x07, 0x74, 0x61, 0x6D, 0x61, 0x72, 0x63, 0x61, 0x0D, 0x00,
+  0x0A, 0x05, 0x79, 0x65, 0x6E, 0x6E, 0x65, 0x0D, 0x00, 0x0B, 0x03, 0x6D, 0x61, 0x6E, 0x0F, 0x00,
+  0x09, 0x06, 0x68, 0x69, 0x63, 0x61, 0x67, 0x6F, 0x14, 0x00, 0x0B, 0x06, 0x68, 0x75, 0x61, 0x68,
+  0x75, 0x61, 0x10, 0x00, 0x09, 0x0C, 0x69, 0x75, 0x64, 0x61, 0x64, 0x5F, 0x4A, 0x75, 0x61, 0x72,
+  0x65, 0x7A, 0x13, 0x00, 0x00, 0x15, 0x41, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x5F, 0x43, 0x6F,
+  0x72, 0x61, 0x6C, 0x5F, 0x48, 0x61, 0x72, 0x62, 0x6F, 0x75, 0x72, 0x0F, 0x00, 0x0B, 0x04, 0x64,
+  0x6F, 0x62, 0x61, 0x0D, 0x00, 0x0A, 0x08, 0x73, 0x74, 0x61, 0x5F, 0x52, 0x69, 0x63, 0x61, 0x10,
+  0x00, 0x09, 0x06, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x6E, 0x15, 0x00, 0x09, 0x05, 0x75, 0x69, 0x61,
+  0x62, 0x61, 0x11, 0x00, 0x0A, 0x05, 0x72, 0x61, 0x63, 0x61, 0x6F, 0x0C, 0x00, 0x08, 0x0C, 0x44,
+  0x61, 0x6E, 0x6D, 0x61, 0x72, 0x6B, 0x73, 0x68, 0x61, 0x76, 0x6E, 0x00, 0x00, 0x0A, 0x04, 0x77,
+  0x73, 0x6F, 0x6E, 0x15, 0x00, 0x0E, 0x06, 0x5F, 0x43, 0x72, 0x65, 0x65, 0x6B, 0x15, 0x00, 0x09,
+  0x05, 0x65, 0x6E, 0x76, 0x65, 0x72, 0x13, 0x00, 0x0A, 0x05, 0x74, 0x72, 0x6F, 0x69, 0x74, 0x16,
+  0x00, 0x09, 0x07, 0x6F, 0x6D, 0x69, 0x6E, 0x69, 0x63, 0x61, 0x0C, 0x00, 0x08, 0x08, 0x45, 0x64,
+  0x6D, 0x6F, 0x6E, 0x74, 0x6F, 0x6E, 0x13, 0x00, 0x09, 0x07, 0x69, 0x72, 0x75, 0x6E, 0x65, 0x70,
+  0x65, 0x12, 0x00, 0x09, 0x0A, 0x6C, 0x5F, 0x53, 0x61, 0x6C, 0x76, 0x61, 0x64, 0x6F, 0x72, 0x10,
+  0x00, 0x09, 0x07, 0x6E, 0x73, 0x65, 0x6E, 0x61, 0x64, 0x61, 0x17, 0x00, 0x00, 0x13, 0x41, 0x6D,
+  0x65, 0x72, 0x69, 0x63, 0x61, 0x5F, 0x46, 0x6F, 0x72, 0x74, 0x5F, 0x4E, 0x65, 0x6C, 0x73, 0x6F,
+  0x6E, 0x15, 0x00, 0x0D, 0x05, 0x57, 0x61, 0x79, 0x6E, 0x65, 0x16, 0x00, 0x0C, 0x05, 0x61, 0x6C,
+  0x65, 0x7A, 0x61, 0x0D, 0x00, 0x08, 0x09, 0x47, 0x6C, 0x61, 0x63, 0x65, 0x5F, 0x42, 0x61, 0x79,
+  0x18, 0x00, 0x09, 0x06, 0x6F, 0x64, 0x74, 0x68, 0x61, 0x62, 0x19, 0x00, 0x0A, 0x07, 0x6F, 0x73,
+  0x65, 0x5F, 0x42, 0x61, 0x79, 0x18, 0x00, 0x09, 0x09, 0x72, 0x61, 0x6E, 0x64, 0x5F, 0x54, 0x75,
+  0x72, 0x6B, 0x16, 0x00, 0x0A, 0x05, 0x65, 0x6E, 0x61, 0x64, 0x61, 0x0C, 0x00, 0x09, 0x09, 0x75,
+  0x61, 0x64, 0x65, 0x6C, 0x6F, 0x75, 0x70, 0x65, 0x0C, 0x00, 0x0B, 0x06, 0x74, 0x65, 0x6D, 0x61,
+  0x6C, 0x61, 0x10, 0x00, 0x0B, 0x06, 0x79, 0x61, 0x71, 0x75, 0x69, 0x6C, 0x12, 0x00, 0x0A, 0x04,
+  0x79, 0x61, 0x6E, 0x61, 0x11, 0x00, 0x08, 0x07, 0x48, 0x61, 0x6C, 0x69, 0x66, 0x61, 0x78, 0x18,
+  0x00, 0x0A, 0x04, 0x76, 0x61, 0x6E, 0x61, 0x1A, 0x00, 0x09, 0x09, 0x65, 0x72, 0x6D, 0x6F, 0x73,
+  0x69, 0x6C, 0x6C, 0x6F, 0x15, 0x00, 0x08, 0x14, 0x49, 0x6E, 0x64, 0x69, 0x61, 0x6E, 0x61, 0x5F,
+  0x49, 0x6E, 0x64, 0x69, 0x61, 0x6E, 0x61, 0x70, 0x6F, 0x6C, 0x69, 0x73, 0x16, 0x00, 0x00, 0x14,
+  0x41, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x5F, 0x49, 0x6E, 0x64, 0x69, 0x61, 0x6E, 0x61, 0x5F,
+  0x4B, 0x6E, 0x6F, 0x78, 0x14, 0x00, 0x10, 0x07, 0x4D, 0x61, 0x72, 0x65, 0x6E, 0x67, 0x6F, 0x16,
+  0x00, 0x10, 0x0A, 0x50, 0x65, 0x74, 0x65, 0x72, 0x73, 0x62, 0x75, 0x72, 0x67, 0x16, 0x00, 0x10,
+  0x09, 0x54, 0x65, 0x6C, 0x6C, 0x5F, 0x43, 0x69, 0x74, 0x79, 0x14, 0x00, 0x10, 0x05, 0x56, 0x65,
+  0x76, 0x61, 0x79, 0x16, 0x00, 0x11, 0x08, 0x69, 0x6E, 0x63, 0x65, 0x6E, 0x6E, 0x65, 0x73, 0x16,
+  0x00, 0x10, 0x07, 0x57, 0x69, 0x6E, 0x61, 0x6D, 0x61, 0x63, 0x16, 0x00, 0x0F, 0x05, 0x70, 0x6F,
+  0x6C, 0x69, 0x73, 0x16, 0x00, 0x0A, 0x04, 0x75, 0x76, 0x69, 0x6B, 0x13, 0x00, 0x09, 0x06, 0x71,
+  0x61, 0x6C, 0x75, 0x69, 0x74, 0x16, 0x00, 0x08, 0x07, 0x4A, 0x61, 0x6D, 0x61, 0x69, 0x63, 0x61,
+  0x0F, 0x00, 0x09, 0x04, 0x75, 0x6A, 0x75, 0x79, 0x0D, 0x00, 0x0A, 0x04, 0x6E, 0x65, 0x61, 0x75,
+  0x0B, 0x00, 0x08, 0x13, 0x4B, 0x65, 0x6E, 0x74, 0x75, 0x63, 0x6B, 0x79, 0x5F, 0x4C, 0x6F, 0x75,
+  0x69, 0x73, 0x76, 0x69, 0x6C, 0x6C, 0x65, 0x16, 0x00, 0x11, 0x0A, 0x4D, 0x6F, 0x6E, 0x74, 0x69,
+  0x63, 0x65, 0x6C, 0x6C, 0x6F, 0x16, 0x00, 0x09, 0x06, 0x6E, 0x6F, 0x78, 0x5F, 0x49, 0x4E, 0x14,
+  0x00, 0x00, 0x12, 0x41, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x5F, 0x4B, 0x72, 0x61, 0x6C, 0x65,
+  0x6E, 0x64, 0x69, 0x6A, 0x6B, 0x0C, 0x00, 0x08, 0x06, 0x4C, 0x61, 0x5F, 0x50, 0x61, 0x7A, 0x11,
+  0x00, 0x09, 0x03, 0x69, 0x6D, 0x61, 0x12, 0x00, 0x09, 0x0A, 0x6F, 0x73, 0x5F, 0x41, 0x6E, 0x67,
+  0x65, 0x6C, 0x65, 0x73, 0x17, 0x00, 0x0A, 0x08, 0x75, 0x69, 0x73, 0x76, 0x69, 0x6C, 0x6C, 0x65,
+  0x16, 0x00, 0x0A, 0x0B, 0x77, 0x65, 0x72, 0x5F, 0x50, 0x72, 0x69, 0x6E, 0x63, 0x65, 0x73, 0x0C,
+  0x00, 0x08, 0x06, 0x4D, 0x61, 0x63, 0x65, 0x69, 0x6F, 0x0D, 0x00, 0x0A, 0x05, 0x6E, 0x61, 0x67,
+  0x75, 0x61, 0x10, 0x00, 0x0C, 0x02, 0x75, 0x73, 0x11, 0x00, 0x0A, 0x05, 0x72, 0x69, 0x67, 0x6F,
+  0x74, 0x0C, 0x00, 0x0B, 0x07, 0x74, 0x69, 0x6E, 0x69, 0x71, 0x75, 0x65, 0x0C, 0x00, 0x0A, 0x07,
+  0x74, 0x61, 0x6D, 0x6F, 0x72, 0x6F, 0x73, 0x14, 0x00, 0x0A, 0x06, 0x7A, 0x61, 0x74, 0x6C, 0x61,
+  0x6E, 0x15, 0x00, 0x09, 0x06, 0x65, 0x6E, 0x64, 0x6F, 0x7A, 0x61, 0x0D, 0x00, 0x0B, 0x06, 0x6F,
+  0x6D, 0x69, 0x6E, 0x65, 0x65, 0x14, 0x00, 0x0A, 0x04, 0x72, 0x69, 0x64, 0x61, 0x10, 0x00, 0x00,
+  0x12, 0x41, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x5F, 0x4D, 0x65, 0x74, 0x6C, 0x61, 0x6B, 0x61,
+  0x74, 0x6C, 0x61, 0x0B, 0x00, 0x0A, 0x09, 0x78, 0x69, 0x63, 0x6F, 0x5F, 0x43, 0x69, 0x74, 0x79,
+  0x10, 0x00, 0x09, 0x07, 0x69, 0x71, 0x75, 0x65, 0x6C, 0x6F, 0x6E, 0x1B, 0x00, 0x09, 0x06, 0x6F,
+  0x6E, 0x63, 0x74, 0x6F, 0x6E, 0x18, 0x00, 0x0B, 0x06, 0x74, 0x65, 0x72, 0x72, 0x65, 0x79, 0x10,
+  0x00, 0x0D, 0x05, 0x76, 0x69, 0x64, 0x65, 0x6F, 0x0D, 0x00, 0x0C, 0x04, 0x72, 0x65, 0x61, 0x6C,
+  0x16, 0x00, 0x0C, 0x06, 0x73, 0x65, 0x72, 0x72, 0x61, 0x74, 0x0C, 0x00, 0x08, 0x06, 0x4E, 0x61,
+  0x73, 0x73, 0x61, 0x75, 0x16, 0x00, 0x09, 0x07, 0x65, 0x77, 0x5F, 0x59, 0x6F, 0x72, 0x6B, 0x16,
+  0x00, 0x09, 0x06, 0x69, 0x70, 0x69, 0x67, 0x6F, 0x6E, 0x16, 0x00, 0x09, 0x03, 0x6F, 0x6D, 0x65,
+  0x0B, 0x00, 0x0A, 0x05, 0x72, 0x6F, 0x6E, 0x68, 0x61, 0x1C, 0x00, 0x0B, 0x10, 0x74, 0x68, 0x5F,
+  0x44, 0x61, 0x6B, 0x6F, 0x74, 0x61, 0x5F, 0x42, 0x65, 0x75, 0x6C, 0x61, 0x68, 0x14, 0x00, 0x15,
+  0x06, 0x43, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x14, 0x00, 0x15, 0x09, 0x4E, 0x65, 0x77, 0x5F, 0x53,
+  0x61, 0x6C, 0x65, 0x6D, 0x14, 0x00, 0x00, 0x0C, 0x41, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x5F,
+  0x4E, 0x75, 0x75, 0x6B, 0x19, 0x00, 0x08, 0x07, 0x4F, 0x6A, 0x69, 0x6E, 0x61, 0x67, 0x61, 0x14,
+  0x00, 0x08, 0x06, 0x50, 0x61, 0x6E, 0x61, 0x6D, 0x61, 0x0F, 0x00, 0x0B, 0x08, 0x67, 0x6E, 0x69,
+  0x72, 0x74, 0x75, 0x6E, 0x67, 0x16, 0x00, 0x0A, 0x08, 0x72, 0x61, 0x6D, 0x61, 0x72, 0x69, 0x62,
+  0x6F, 0x0D, 0x00, 0x09, 0x06, 0x68, 0x6F, 0x65, 0x6E, 0x69, 0x78, 0x15, 0x00, 0x09, 0x0D, 0x6F,
+  0x72, 0x74, 0x6D, 0x61, 0x75, 0x6D, 0x50, 0x72, 0x69, 0x6E, 0x63, 0x65, 0x16, 0x00, 0x0C, 0x09,
+  0x5F, 0x6F, 0x66, 0x5F, 0x53, 0x70, 0x61, 0x69, 0x6E, 0x0C, 0x00, 0x0C, 0x06, 0x6F, 0x5F, 0x41,
+  0x63, 0x72, 0x65, 0x12, 0x00, 0x0E, 0x05, 0x56, 0x65, 0x6C, 0x68, 0x6F, 0x11, 0x00, 0x09, 0x0A,
+  0x75, 0x65, 0x72, 0x74, 0x6F, 0x5F, 0x52, 0x69, 0x63, 0x6F, 0x0C, 0x00, 0x0A, 0x0A, 0x6E, 0x74,
+  0x61, 0x5F, 0x41, 0x72, 0x65, 0x6E, 0x61, 0x73, 0x0D, 0x00, 0x08, 0x0B, 0x52, 0x61, 0x69, 0x6E,
+  0x79, 0x5F, 0x52, 0x69, 0x76, 0x65, 0x72, 0x14, 0x00, 0x0A, 0x0A, 0x6E, 0x6B, 0x69, 0x6E, 0x5F,
+  0x49, 0x6E, 0x6C, 0x65, 0x74, 0x14, 0x00, 0x09, 0x05, 0x65, 0x63, 0x69, 0x66, 0x65, 0x0D, 0x00,
+  0x0A, 0x04, 0x67, 0x69, 0x6E, 0x61, 0x10, 0x00, 0x00, 0x10, 0x41, 0x6D, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x5F, 0x52, 0x65, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x14, 0x00, 0x09, 0x09, 0x69, 0x6F,
+  0x5F, 0x42, 0x72, 0x61, 0x6E, 0x63, 0x6F, 0x12, 0x00, 0x09, 0x06, 0x6F, 0x73, 0x61, 0x72, 0x69,
+  0x6F, 0x0D, 0x00, 0x08, 0x0C, 0x53, 0x61, 0x6E, 0x74, 0x61, 0x5F, 0x49, 0x73, 0x61, 0x62, 0x65,
+  0x6C, 0x17, 0x00, 0x0D, 0x03, 0x72, 0x65, 0x6D, 0x0D, 0x00, 0x0C, 0x04, 0x69, 0x61, 0x67, 0x6F,
+  0x1D, 0x00, 0x0C, 0x09, 0x6F, 0x5F, 0x44, 0x6F, 0x6D, 0x69, 0x6E, 0x67, 0x6F, 0x0C, 0x00, 0x0A,
+  0x07, 0x6F, 0x5F, 0x50, 0x61, 0x75, 0x6C, 0x6F, 0x0D, 0x00, 0x09, 0x0B, 0x63, 0x6F, 0x72, 0x65,
+  0x73, 0x62, 0x79, 0x73, 0x75, 0x6E, 0x64, 0x19, 0x00, 0x09, 0x07, 0x68, 0x69, 0x70, 0x72, 0x6F,
+  0x63, 0x6B, 0x13, 0x00, 0x09, 0x04, 0x69, 0x74, 0x6B, 0x61, 0x0B, 0x00, 0x09, 0x0C, 0x74, 0x5F,
+  0x42, 0x61, 0x72, 0x74, 0x68, 0x65, 0x6C, 0x65, 0x6D, 0x79, 0x0C, 0x00, 0x0B, 0x05, 0x4A, 0x6F,
+  0x68, 0x6E, 0x73, 0x1E, 0x00, 0x0B, 0x05, 0x4B, 0x69, 0x74, 0x74, 0x73, 0x0C, 0x00, 0x0B, 0x05,
+  0x4C, 0x75, 0x63, 0x69, 0x61, 0x0C, 0x00, 0x0B, 0x06, 0x54, 0x68, 0x6F, 0x6D, 0x61, 0x73, 0x0C,
+  0x00, 0x00, 0x12, 0x41, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x5F, 0x53, 0x74, 0x5F, 0x56, 0x69,
+  0x6E, 0x63, 0x65, 0x6E, 0x74, 0x0C, 0x00, 0x09, 0x0C, 0x77, 0x69, 0x66, 0x74, 0x5F, 0x43, 0x75,
+  0x72, 0x72, 0x65, 0x6E, 0x74, 0x10, 0x00, 0x08, 0x0B, 0x54, 0x65, 0x67, 0x75, 0x63, 0x69, 0x67,
+  0x61, 0x6C, 0x70, 0x61, 0x10, 0x00, 0x09, 0x04, 0x68, 0x75, 0x6C, 0x65, 0x18, 0x00, 0x0B, 0x08,
+  0x6E, 0x64, 0x65, 0x72, 0x5F, 0x42, 0x61, 0x79, 0x16, 0x00, 0x09, 0x06, 0x69, 0x6A, 0x75, 0x61,
+  0x6E, 0x61, 0x17, 0x00, 0x09, 0x06, 0x6F, 0x72, 0x6F, 0x6E, 0x74, 0x6F, 0x16, 0x00, 0x0B, 0x04,
+  0x74, 0x6F, 0x6C, 0x61, 0x0C, 0x00, 0x08, 0x09, 0x56, 0x61, 0x6E, 0x63, 0x6F, 0x75, 0x76, 0x65,
+  0x72, 0x17, 0x00, 0x09, 0x05, 0x69, 0x72, 0x67, 0x69, 0x6E, 0x0C, 0x00, 0x08, 0x0A, 0x57, 0x68,
+  0x69, 0x74, 0x65, 0x68, 0x6F, 0x72, 0x73, 0x65, 0x15, 0x00, 0x09, 0x07, 0x69, 0x6E, 0x6E, 0x69,
+  0x70, 0x65, 0x67, 0x14, 0x00, 0x08, 0x07, 0x59, 0x61, 0x6B, 0x75, 0x74, 0x61, 0x74, 0x0B, 0x00,
+  0x09, 0x0A, 0x65, 0x6C, 0x6C, 0x6F, 0x77, 0x6B, 0x6E, 0x69, 0x66, 0x65, 0x13, 0x00, 0x01, 0x0F,
+  0x6E, 0x74, 0x61, 0x72, 0x63, 0x74, 0x69, 0x63, 0x61, 0x5F, 0x43, 0x61, 0x73, 0x65, 0x79, 0x1F,
+  0x00, 0x0B, 0x05, 0x44, 0x61, 0x76, 0x69, 0x73, 0x20, 0x00, 0x00, 0x19, 0x41, 0x6E, 0x74, 0x61,
+  0x72, 0x63, 0x74, 0x69, 0x63, 0x61, 0x5F, 0x44, 0x75, 0x6D, 0x6F, 0x6E, 0x74, 0x44, 0x55, 0x72,
+  0x76, 0x69, 0x6C, 0x6C, 0x65, 0x21, 0x00, 0x0B, 0x09, 0x4D, 0x61, 0x63, 0x71, 0x75, 0x61, 0x72,
+  0x69, 0x65, 0x22, 0x00, 0x0D, 0x04, 0x77, 0x73, 0x6F, 0x6E, 0x23, 0x00, 0x0C, 0x06, 0x63, 0x4D,
+  0x75, 0x72, 0x64, 0x6F, 0x24, 0x00, 0x0B, 0x06, 0x50, 0x61, 0x6C, 0x6D, 0x65, 0x72, 0x0D, 0x00,
+  0x0B, 0x07, 0x52, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x61, 0x0D, 0x00, 0x0B, 0x0A, 0x53, 0x6F, 0x75,
+  0x74, 0x68, 0x5F, 0x50, 0x6F, 0x6C, 0x65, 0x24, 0x00, 0x0C, 0x04, 0x79, 0x6F, 0x77, 0x61, 0x25,
+  0x00, 0x0B, 0x05, 0x54, 0x72, 0x6F, 0x6C, 0x6C, 0x26, 0x00, 0x0B, 0x06, 0x56, 0x6F, 0x73, 0x74,
+  0x6F, 0x6B, 0x23, 0x00, 0x01, 0x12, 0x72, 0x63, 0x74, 0x69, 0x63, 0x5F, 0x4C, 0x6F, 0x6E, 0x67,
+  0x79, 0x65, 0x61, 0x72, 0x62, 0x79, 0x65, 0x6E, 0x07, 0x00, 0x01, 0x08, 0x73, 0x69, 0x61, 0x5F,
+  0x41, 0x64, 0x65, 0x6E, 0x25, 0x00, 0x06, 0x05, 0x6C, 0x6D, 0x61, 0x74, 0x79, 0x27, 0x00, 0x06,
+  0x04, 0x6D, 0x6D, 0x61, 0x6E, 0x25, 0x00, 0x06, 0x05, 0x6E, 0x61, 0x64, 0x79, 0x72, 0x28, 0x00,
+  0x06, 0x04, 0x71, 0x74, 0x61, 0x75, 0x23, 0x00, 0x00, 0x0B, 0x41, 0x73, 0x69, 0x61, 0x5F, 0x41,
+  0x71, 0x74, 0x6F, 0x62, 0x65, 0x23, 0x00, 0x06, 0x07, 0x73, 0x68, 0x67, 0x61, 0x62, 0x61, 0x74,
+  0x23, 0x00, 0x08, 0x06, 0x6B, 0x68, 0x61, 0x62, 0x61, 0x64, 0x23, 0x00, 0x06, 0x05, 0x74, 0x79,
+  0x72, 0x61, 0x75, 0x23, 0x00, 0x05, 0x07, 0x42, 0x61, 0x67, 0x68, 0x64, 0x61, 0x64, 0x25, 0x00,
+  0x07, 0x05, 0x68, 0x72, 0x61, 0x69, 0x6E, 0x25, 0x00, 0x07, 0x02, 0x6B, 0x75, 0x29, 0x00, 0x07,
+  0x05, 0x6E, 0x67, 0x6B, 0x6F, 0x6B, 0x20, 0x00, 0x07, 0x05, 0x72, 0x6E, 0x61, 0x75, 0x6C, 0x20,
+  0x00, 0x06, 0x05, 0x65, 0x69, 0x72, 0x75, 0x74, 0x2A, 0x00, 0x06, 0x06, 0x69, 0x73, 0x68, 0x6B,
+  0x65, 0x6B, 0x27, 0x00, 0x06, 0x05, 0x72, 0x75, 0x6E, 0x65, 0x69, 0x1F, 0x00, 0x05, 0x08, 0x43,
+  0x61, 0x6C, 0x63, 0x75, 0x74, 0x74, 0x61, 0x2B, 0x00, 0x06, 0x04, 0x68, 0x69, 0x74, 0x61, 0x2C,
+  0x00, 0x07, 0x08, 0x6F, 0x69, 0x62, 0x61, 0x6C, 0x73, 0x61, 0x6E, 0x1F, 0x00, 0x08, 0x06, 0x6E,
+  0x67, 0x71, 0x69, 0x6E, 0x67, 0x2D, 0x00, 0x00, 0x0E, 0x41, 0x73, 0x69, 0x61, 0x5F, 0x43, 0x68,
+  0x75, 0x6E, 0x67, 0x6B, 0x69, 0x6E, 0x67, 0x2D, 0x00, 0x06, 0x06, 0x6F, 0x6C, 0x6F, 0x6D, 0x62,
+  0x6F, 0x2E, 0x00, 0x05, 0x05, 0x44, 0x61, 0x63, 0x63, 0x61, 0x27, 0x00, 0x07, 0x06, 0x6D, 0x61,
+  0x73, 0x63, 0x75, 0x73, 0x25, 0x00, 0x06, 0x04, 0x68, 0x61, 0x6B, 0x61, 0x27, 0x00, 0x06, 0x03,
+  0x69, 0x6C, 0x69, 0x2C, 0x00, 0x06, 0x04, 0x75, 0x62, 0x61, 0x69, 0x29, 0x00, 0x07, 0x06, 0x73,
+  0x68, 0x61, 0x6E, 0x62, 0x65, 0x23, 0x00, 0x05, 0x09, 0x46, 0x61, 0x6D, 0x61, 0x67, 0x75, 0x73,
+  0x74, 0x61, 0x2F, 0x00, 0x05, 0x04, 0x47, 0x61, 0x7A, 0x61, 0x30, 0x00, 0x05, 0x06, 0x48, 0x61,
+  0x72, 0x62, 0x69, 0x6E, 0x2D, 0x00, 0x06, 0x05, 0x65, 0x62, 0x72, 0x6F, 0x6E, 0x30, 0x00, 0x06,
+  0x0A, 0x6F, 0x5F, 0x43, 0x68, 0x69, 0x5F, 0x4D, 0x69, 0x6E, 0x68, 0x20, 0x00, 0x07, 0x07, 0x6E,
+  0x67, 0x5F, 0x4B, 0x6F, 0x6E, 0x67, 0x31, 0x00, 0x07, 0x02, 0x76, 0x64, 0x20, 0x00, 0x05, 0x07,
+  0x49, 0x72, 0x6B, 0x75, 0x74, 0x73, 0x6B, 0x1F, 0x00, 0x00, 0x0D, 0x41, 0x73, 0x69, 0x61, 0x5F,
+  0x49, 0x73, 0x74, 0x61, 0x6E, 0x62, 0x75, 0x6C, 0x25, 0x00, 0x05, 0x07, 0x4A, 0x61, 0x6B, 0x61,
+  0x72, 0x74, 0x61, 0x32, 0x00, 0x07, 0x06, 0x79, 0x61, 0x70, 0x75, 0x72, 0x61, 0x33, 0x00, 0x06,
+  0x08, 0x65, 0x72, 0x75, 0x73, 0x61, 0x6C, 0x65, 0x6D, 0x34, 0x00, 0x05, 0x05, 0x4B, 0x61, 0x62,
+  0x75, 0x6C, 0x35, 0x00, 0x07, 0x07, 0x6D, 0x63, 0x68, 0x61, 0x74, 0x6B, 0x61, 0x28, 0x00, 0x07,
+  0x05, 0x72, 0x61, 0x63, 0x68, 0x69, 0x36, 0x00, 0x07, 0x05, 0x73, 0x68, 0x67, 0x61, 0x72, 0x27,
+  0x00, 0x07, 0x07, 0x74, 0x68, 0x6D, 0x61, 0x6E, 0x64, 0x75, 0x37, 0x00, 0x08, 0x05, 0x6D, 0x61,
+  0x6E, 0x64, 0x75, 0x37, 0x00, 0x06, 0x07, 0x68, 0x61, 0x6E, 0x64, 0x79, 0x67, 0x61, 0x2C, 0x00,
+  0x06, 0x06, 0x6F, 0x6C, 0x6B, 0x61, 0x74, 0x61, 0x2B, 0x00, 0x06, 0x0A, 0x72, 0x61, 0x73, 0x6E,
+  0x6F, 0x79, 0x61, 0x72, 0x73, 0x6B, 0x20, 0x00, 0x06, 0x0B, 0x75, 0x61, 0x6C, 0x61, 0x5F, 0x4C,
+  0x75, 0x6D, 0x70, 0x75, 0x72, 0x1F, 0x00, 0x07, 0x05, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x1F, 0x00,
+  0x07, 0x04, 0x77, 0x61, 0x69, 0x74, 0x25, 0x00, 0x00, 0x0A, 0x41, 0x73, 0x69, 0x61, 0x5F, 0x4D,
+  0x61, 0x63, 0x61, 0x6F, 0x2D, 0x00, 0x09, 0x01, 0x75, 0x2D, 0x00, 0x07, 0x05, 0x67, 0x61, 0x64,
+  0x61, 0x6E, 0x38, 0x00, 0x07, 0x06, 0x6B, 0x61, 0x73, 0x73, 0x61, 0x72, 0x39, 0x00, 0x07, 0x04,
+  0x6E, 0x69, 0x6C, 0x61, 0x3A, 0x00, 0x06, 0x05, 0x75, 0x73, 0x63, 0x61, 0x74, 0x29, 0x00, 0x05,
+  0x07, 0x4E, 0x69, 0x63, 0x6F, 0x73, 0x69, 0x61, 0x2F, 0x00, 0x06, 0x0B, 0x6F, 0x76, 0x6F, 0x6B,
+  0x75, 0x7A, 0x6E, 0x65, 0x74, 0x73, 0x6B, 0x20, 0x00, 0x09, 0x07, 0x73, 0x69, 0x62, 0x69, 0x72,
+  0x73, 0x6B, 0x20, 0x00, 0x05, 0x04, 0x4F, 0x6D, 0x73, 0x6B, 0x27, 0x00, 0x06, 0x03, 0x72, 0x61,
+  0x6C, 0x23, 0x00, 0x05, 0x0A, 0x50, 0x68, 0x6E, 0x6F, 0x6D, 0x5F, 0x50, 0x65, 0x6E, 0x68, 0x20,
+  0x00, 0x06, 0x08, 0x6F, 0x6E, 0x74, 0x69, 0x61, 0x6E, 0x61, 0x6B, 0x32, 0x00, 0x06, 0x08, 0x79,
+  0x6F, 0x6E, 0x67, 0x79, 0x61, 0x6E, 0x67, 0x3B, 0x00, 0x05, 0x05, 0x51, 0x61, 0x74, 0x61, 0x72,
+  0x25, 0x00, 0x06, 0x07, 0x6F, 0x73, 0x74, 0x61, 0x6E, 0x61, 0x79, 0x27, 0x00, 0x00, 0x0E, 0x41,
+  0x73, 0x69, 0x61, 0x5F, 0x51, 0x79, 0x7A, 0x79, 0x6C, 0x6F, 0x72, 0x64, 0x61, 0x23, 0x00, 0x05,
+  0x07, 0x52, 0x61, 0x6E, 0x67, 0x6F, 0x6F, 0x6E, 0x3C, 0x00, 0x06, 0x05, 0x69, 0x79, 0x61, 0x64,
+  0x68, 0x25, 0x00, 0x05, 0x06, 0x53, 0x61, 0x69, 0x67, 0x6F, 0x6E, 0x20, 0x00, 0x07, 0x06, 0x6B,
+  0x68, 0x61, 0x6C, 0x69, 0x6E, 0x38, 0x00, 0x07, 0x07, 0x6D, 0x61, 0x72, 0x6B, 0x61, 0x6E, 0x64,
+  0x23, 0x00, 0x06, 0x04, 0x65, 0x6F, 0x75, 0x6C, 0x3B, 0x00, 0x06, 0x07, 0x68, 0x61, 0x6E, 0x67,
+  0x68, 0x61, 0x69, 0x2D, 0x00, 0x06, 0x08, 0x69, 0x6E, 0x67, 0x61, 0x70, 0x6F, 0x72, 0x65, 0x1F,
+  0x00, 0x06, 0x0C, 0x72, 0x65, 0x64, 0x6E, 0x65, 0x6B, 0x6F, 0x6C, 0x79, 0x6D, 0x73, 0x6B, 0x38,
+  0x00, 0x05, 0x06, 0x54, 0x61, 0x69, 0x70, 0x65, 0x69, 0x2D, 0x00, 0x07, 0x06, 0x73, 0x68, 0x6B,
+  0x65, 0x6E, 0x74, 0x23, 0x00, 0x06, 0x06, 0x62, 0x69, 0x6C, 0x69, 0x73, 0x69, 0x29, 0x00, 0x06,
+  0x05, 0x65, 0x68, 0x72, 0x61, 0x6E, 0x3D, 0x00, 0x07, 0x06, 0x6C, 0x5F, 0x41, 0x76, 0x69, 0x76,
+  0x34, 0x00, 0x06, 0x05, 0x68, 0x69, 0x6D, 0x62, 0x75, 0x27, 0x00, 0x00, 0x0C, 0x41, 0x73, 0x69,
+  0x61, 0x5F, 0x54, 0x68, 0x69, 0x6D, 0x70, 0x68, 0x75, 0x27, 0x00, 0x06, 0x04, 0x6F, 0x6B, 0x79,
+  0x6F, 0x3E, 0x00, 0x07, 0x03, 0x6D, 0x73, 0x6B, 0x20, 0x00, 0x05, 0x0D, 0x55, 0x6A, 0x75, 0x6E,
+  0x67, 0x5F, 0x50, 0x61, 0x6E, 0x64, 0x61, 0x6E, 0x67, 0x39, 0x00, 0x06, 0x0A, 0x6C, 0x61, 0x61,
+  0x6E, 0x62, 0x61, 0x61, 0x74, 0x61, 0x72, 0x1F, 0x00, 0x08, 0x07, 0x6E, 0x5F, 0x42, 0x61, 0x74,
+  0x6F, 0x72, 0x1F, 0x00, 0x06, 0x05, 0x72, 0x75, 0x6D, 0x71, 0x69, 0x27, 0x00, 0x06, 0x07, 0x73,
+  0x74, 0x6D, 0x4E, 0x65, 0x72, 0x61, 0x21, 0x00, 0x05, 0x09, 0x56, 0x69, 0x65, 0x6E, 0x74, 0x69,
+  0x61, 0x6E, 0x65, 0x20, 0x00, 0x06, 0x0A, 0x6C, 0x61, 0x64, 0x69, 0x76, 0x6F, 0x73, 0x74, 0x6F,
+  0x6B, 0x21, 0x00, 0x05, 0x07, 0x59, 0x61, 0x6B, 0x75, 0x74, 0x73, 0x6B, 0x2C, 0x00, 0x07, 0x04,
+  0x6E, 0x67, 0x6F, 0x6E, 0x3C, 0x00, 0x06, 0x0C, 0x65, 0x6B, 0x61, 0x74, 0x65, 0x72, 0x69, 0x6E,
+  0x62, 0x75, 0x72, 0x67, 0x23, 0x00, 0x07, 0x05, 0x72, 0x65, 0x76, 0x61, 0x6E, 0x29, 0x00, 0x01,
+  0x0E, 0x74, 0x6C, 0x61, 0x6E, 0x74, 0x69, 0x63, 0x5F, 0x41, 0x7A, 0x6F, 0x72, 0x65, 0x73, 0x3F,
+  0x00, 0x09, 0x07, 0x42, 0x65, 0x72, 0x6D, 0x75, 0x64, 0x61, 0x18, 0x00, 0x00, 0x0F, 0x41, 0x74,
+  0x6C, 0x61, 0x6E, 0x74, 0x69, 0x63, 0x5F, 0x43, 0x61, 0x6E, 0x61, 0x72, 0x79, 0x40, 0x00, 0x0B,
+  0x08, 0x70, 0x65, 0x5F, 0x56, 0x65, 0x72, 0x64, 0x65, 0x41, 0x00, 0x09, 0x06, 0x46, 0x61, 0x65,
+  0x72, 0x6F, 0x65, 0x40, 0x00, 0x0B, 0x03, 0x72, 0x6F, 0x65, 0x40, 0x00, 0x09, 0x09, 0x4A, 0x61,
+  0x6E, 0x5F, 0x4D, 0x61, 0x79, 0x65, 0x6E, 0x07, 0x00, 0x09, 0x07, 0x4D, 0x61, 0x64, 0x65, 0x69,
+  0x72, 0x61, 0x40, 0x00, 0x09, 0x09, 0x52, 0x65, 0x79, 0x6B, 0x6A, 0x61, 0x76, 0x69, 0x6B, 0x00,
+  0x00, 0x09, 0x0D, 0x53, 0x6F, 0x75, 0x74, 0x68, 0x5F, 0x47, 0x65, 0x6F, 0x72, 0x67, 0x69, 0x61,
+  0x1C, 0x00, 0x0A, 0x08, 0x74, 0x5F, 0x48, 0x65, 0x6C, 0x65, 0x6E, 0x61, 0x00, 0x00, 0x0B, 0x05,
+  0x61, 0x6E, 0x6C, 0x65, 0x79, 0x0D, 0x00, 0x01, 0x0C, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6C, 0x69,
+  0x61, 0x5F, 0x41, 0x43, 0x54, 0x22, 0x00, 0x0B, 0x07, 0x64, 0x65, 0x6C, 0x61, 0x69, 0x64, 0x65,
+  0x42, 0x00, 0x0A, 0x08, 0x42, 0x72, 0x69, 0x73, 0x62, 0x61, 0x6E, 0x65, 0x43, 0x00, 0x0C, 0x09,
+  0x6F, 0x6B, 0x65, 0x6E, 0x5F, 0x48, 0x69, 0x6C, 0x6C, 0x42, 0x00, 0x0A, 0x08, 0x43, 0x61, 0x6E,
+  0x62, 0x65, 0x72, 0x72, 0x61, 0x22, 0x00, 0x0B, 0x05, 0x75, 0x72, 0x72, 0x69, 0x65, 0x22, 0x00,
+  0x00, 0x10, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6C, 0x69, 0x61, 0x5F, 0x44, 0x61, 0x72, 0x77,
+  0x69, 0x6E, 0x44, 0x00, 0x0A, 0x05, 0x45, 0x75, 0x63, 0x6C, 0x61, 0x45, 0x00, 0x0A, 0x06, 0x48,
+  0x6F, 0x62, 0x61, 0x72, 0x74, 0x22, 0x00, 0x0A, 0x03, 0x4C, 0x48, 0x49, 0x46, 0x00, 0x0B, 0x07,
+  0x69, 0x6E, 0x64, 0x65, 0x6D, 0x61, 0x6E, 0x43, 0x00, 0x0B, 0x08, 0x6F, 0x72, 0x64, 0x5F, 0x48,
+  0x6F, 0x77, 0x65, 0x46, 0x00, 0x0A, 0x09, 0x4D, 0x65, 0x6C, 0x62, 0x6F, 0x75, 0x72, 0x6E, 0x65,
+  0x22, 0x00, 0x0A, 0x03, 0x4E, 0x53, 0x57, 0x22, 0x00, 0x0B, 0x04, 0x6F, 0x72, 0x74, 0x68, 0x44,
+  0x00, 0x0A, 0x05, 0x50, 0x65, 0x72, 0x74, 0x68, 0x47, 0x00, 0x0A, 0x0A, 0x51, 0x75, 0x65, 0x65,
+  0x6E, 0x73, 0x6C, 0x61, 0x6E, 0x64, 0x43, 0x00, 0x0A, 0x05, 0x53, 0x6F, 0x75, 0x74, 0x68, 0x42,
+  0x00, 0x0B, 0x05, 0x79, 0x64, 0x6E, 0x65, 0x79, 0x22, 0x00, 0x0A, 0x08, 0x54, 0x61, 0x73, 0x6D,
+  0x61, 0x6E, 0x69, 0x61, 0x22, 0x00, 0x0A, 0x08, 0x56, 0x69, 0x63, 0x74, 0x6F, 0x72, 0x69, 0x61,
+  0x22, 0x00, 0x0A, 0x04, 0x57, 0x65, 0x73, 0x74, 0x47, 0x00, 0x00, 0x14, 0x41, 0x75, 0x73, 0x74,
+  0x72, 0x61, 0x6C, 0x69, 0x61, 0x5F, 0x59, 0x61, 0x6E, 0x63, 0x6F, 0x77, 0x69, 0x6E, 0x6E, 0x61,
+  0x42, 0x00, 0x00, 0x0B, 0x42, 0x72, 0x61, 0x7A, 0x69, 0x6C, 0x5F, 0x41, 0x63, 0x72, 0x65, 0x12,
+  0x00, 0x07, 0x09, 0x44, 0x65, 0x4E, 0x6F, 0x72, 0x6F, 0x6E, 0x68, 0x61, 0x1C, 0x00, 0x07, 0x04,
+  0x45, 0x61, 0x73, 0x74, 0x0D, 0x00, 0x07, 0x04, 0x57, 0x65, 0x73, 0x74, 0x11, 0x00, 0x00, 0x03,
+  0x43, 0x45, 0x54, 0x07, 0x00, 0x01, 0x06, 0x53, 0x54, 0x36, 0x43, 0x44, 0x54, 0x14, 0x00, 0x01,
+  0x0E, 0x61, 0x6E, 0x61, 0x64, 0x61, 0x5F, 0x41, 0x74, 0x6C, 0x61, 0x6E, 0x74, 0x69, 0x63, 0x18,
+  0x00, 0x07, 0x07, 0x43, 0x65, 0x6E, 0x74, 0x72, 0x61, 0x6C, 0x14, 0x00, 0x07, 0x07, 0x45, 0x61,
+  0x73, 0x74, 0x65, 0x72, 0x6E, 0x16, 0x00, 0x07, 0x08, 0x4D, 0x6F, 0x75, 0x6E, 0x74, 0x61, 0x69,
+  0x6E, 0x13, 0x00, 0x07, 0x0C, 0x4E, 0x65, 0x77, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x6C, 0x61, 0x6E,
+  0x64, 0x1E, 0x00, 0x07, 0x07, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x17, 0x00, 0x07, 0x0C,
+  0x53, 0x61, 0x73, 0x6B, 0x61, 0x74, 0x63, 0x68, 0x65, 0x77, 0x61, 0x6E, 0x10, 0x00, 0x07, 0x05,
+  0x59, 0x75, 0x6B, 0x6F, 0x6E, 0x15, 0x00, 0x01, 0x10, 0x68, 0x69, 0x6C, 0x65, 0x5F, 0x43, 0x6F,
+  0x6E, 0x74, 0x69, 0x6E, 0x65, 0x6E, 0x74, 0x61, 0x6C, 0x1D, 0x00, 0x00, 0x12, 0x43, 0x68, 0x69,
+  0x6C, 0x65, 0x5F, 0x45, 0x61, 0x73, 0x74, 0x65, 0x72, 0x49, 0x73, 0x6C, 0x61, 0x6E, 0x64, 0x48,
+  0x00, 0x01, 0x03, 0x75, 0x62, 0x61, 0x1A, 0x00, 0x00, 0x03, 0x45, 0x45, 0x54, 0x2F, 0x00, 0x01,
+  0x02, 0x53, 0x54, 0x0F, 0x00, 0x03, 0x04, 0x35, 0x45, 0x44, 0x54, 0x16, 0x00, 0x01, 0x04, 0x67,
+  0x79, 0x70, 0x74, 0x05, 0x00, 0x01, 0x03, 0x69, 0x72, 0x65, 0x49, 0x00, 0x01, 0x06, 0x74, 0x63,
+  0x5F, 0x47, 0x4D, 0x54, 0x00, 0x00, 0x07, 0x02, 0x70, 0x30, 0x00, 0x00, 0x08, 0x01, 0x31, 0x41,
+  0x00, 0x09, 0x01, 0x30, 0x4A, 0x00, 0x09, 0x01, 0x31, 0x4B, 0x00, 0x09, 0x01, 0x32, 0x4C, 0x00,
+  0x08, 0x01, 0x32, 0x1C, 0x00, 0x08, 0x01, 0x33, 0x0D, 0x00, 0x08, 0x01, 0x34, 0x11, 0x00, 0x00,
+  0x09, 0x45, 0x74, 0x63, 0x5F, 0x47, 0x4D, 0x54, 0x70, 0x35, 0x12, 0x00, 0x08, 0x01, 0x36, 0x4D,
+  0x00, 0x08, 0x01, 0x37, 0x4E, 0x00, 0x08, 0x01, 0x38, 0x4F, 0x00, 0x08, 0x01, 0x39, 0x50, 0x00,
+  0x07, 0x02, 0x6D, 0x30, 0x00, 0x00, 0x08, 0x01, 0x31, 0x06, 0x00, 0x09, 0x01, 0x30, 0x21, 0x00,
+  0x09, 0x01, 0x31, 0x38, 0x00, 0x09, 0x01, 0x32, 0x28, 0x00, 0x09, 0x01, 0x33, 0x51, 0x00, 0x09,
+  0x01, 0x34, 0x52, 0x00, 0x08, 0x01, 0x32, 0x53, 0x00, 0x08, 0x01, 0x33, 0x25, 0x00, 0x08, 0x01,
+  0x34, 0x29, 0x00, 0x08, 0x01, 0x35, 0x23, 0x00, 0x00, 0x09, 0x45, 0x74, 0x63, 0x5F, 0x47, 0x4D,
+  0x54, 0x6D, 0x36, 0x27, 0x00, 0x08, 0x01, 0x37, 0x20, 0x00, 0x08, 0x01, 0x38, 0x1F, 0x00, 0x08,
+  0x01, 0x39, 0x2C, 0x00, 0x07, 0x01, 0x30, 0x00, 0x00, 0x05, 0x08, 0x72, 0x65, 0x65, 0x6E, 0x77,
+  0x69, 0x63, 0x68, 0x00, 0x00, 0x04, 0x03, 0x55, 0x43, 0x54, 0x54, 0x00, 0x05, 0x02, 0x54, 0x43,
+  0x54, 0x00, 0x05, 0x08, 0x6E, 0x69, 0x76, 0x65, 0x72, 0x73, 0x61, 0x6C, 0x54, 0x00, 0x04, 0x04,
+  0x5A, 0x75, 0x6C, 0x75, 0x54, 0x00, 0x01, 0x0F, 0x75, 0x72, 0x6F, 0x70, 0x65, 0x5F, 0x41, 0x6D,
+  0x73, 0x74, 0x65, 0x72, 0x64, 0x61, 0x6D, 0x07, 0x00, 0x08, 0x06, 0x6E, 0x64, 0x6F, 0x72, 0x72,
+  0x61, 0x07, 0x00, 0x08, 0x08, 0x73, 0x74, 0x72, 0x61, 0x6B, 0x68, 0x61, 0x6E, 0x29, 0x00, 0x08,
+  0x05, 0x74, 0x68, 0x65, 0x6E, 0x73, 0x2F, 0x00, 0x07, 0x07, 0x42, 0x65, 0x6C, 0x66, 0x61, 0x73,
+  0x74, 0x55, 0x00, 0x0A, 0x05, 0x67, 0x72, 0x61, 0x64, 0x65, 0x07, 0x00, 0x00, 0x0D, 0x45, 0x75,
+  0x72, 0x6F, 0x70, 0x65, 0x5F, 0x42, 0x65, 0x72, 0x6C, 0x69, 0x6E, 0x07, 0x00, 0x08, 0x09, 0x72,
+  0x61, 0x74, 0x69, 0x73, 0x6C, 0x61, 0x76, 0x61, 0x07, 0x00, 0x09, 0x06, 0x75, 0x73, 0x73, 0x65,
+  0x6C, 0x73, 0x07, 0x00, 0x08, 0x08, 0x75, 0x63, 0x68, 0x61, 0x72, 0x65, 0x73, 0x74, 0x2F, 0x00,
+  0x09, 0x06, 0x64, 0x61, 0x70, 0x65, 0x73, 0x74, 0x07, 0x00, 0x09, 0x06, 0x73, 0x69, 0x6E, 0x67,
+  0x65, 0x6E, 0x07, 0x00, 0x07, 0x08, 0x43, 0x68, 0x69, 0x73, 0x69, 0x6E, 0x61, 0x75, 0x56, 0x00,
+  0x08, 0x09, 0x6F, 0x70, 0x65, 0x6E, 0x68, 0x61, 0x67, 0x65, 0x6E, 0x07, 0x00, 0x07, 0x06, 0x44,
+  0x75, 0x62, 0x6C, 0x69, 0x6E, 0x49, 0x00, 0x07, 0x09, 0x47, 0x69, 0x62, 0x72, 0x61, 0x6C, 0x74,
+  0x61, 0x72, 0x07, 0x00, 0x08, 0x07, 0x75, 0x65, 0x72, 0x6E, 0x73, 0x65, 0x79, 0x55, 0x00, 0x07,
+  0x08, 0x48, 0x65, 0x6C, 0x73, 0x69, 0x6E, 0x6B, 0x69, 0x2F, 0x00, 0x07, 0x0B, 0x49, 0x73, 0x6C,
+  0x65, 0x5F, 0x6F, 0x66, 0x5F, 0x4D, 0x61, 0x6E, 0x55, 0x00, 0x09, 0x06, 0x74, 0x61, 0x6E, 0x62,
+  0x75, 0x6C, 0x25, 0x00, 0x07, 0x06, 0x4A, 0x65, 0x72, 0x73, 0x65, 0x79, 0x55, 0x00, 0x07, 0x0B,
+  0x4B, 0x61, 0x6C, 0x69, 0x6E, 0x69, 0x6E, 0x67, 0x72, 0x61, 0x64, 0x09, 0x00, 0x00, 0x0B, 0x45,
+  0x75, 0x72, 0x6F, 0x70, 0x65, 0x5F, 0x4B, 0x69, 0x65, 0x76, 0x2F, 0x00, 0x09, 0x03, 0x72, 0x6F,
+  0x76, 0x57, 0x00, 0x08, 0x03, 0x79, 0x69, 0x76, 0x2F, 0x00, 0x07, 0x06, 0x4C, 0x69, 0x73, 0x62,
+  0x6F, 0x6E, 0x40, 0x00, 0x08, 0x08, 0x6A, 0x75, 0x62, 0x6C, 0x6A, 0x61, 0x6E, 0x61, 0x07, 0x00,
+  0x08, 0x05, 0x6F, 0x6E, 0x64, 0x6F, 0x6E, 0x55, 0x00, 0x08, 0x09, 0x75, 0x78, 0x65, 0x6D, 0x62,
+  0x6F, 0x75, 0x72, 0x67, 0x07, 0x00, 0x07, 0x06, 0x4D, 0x61, 0x64, 0x72, 0x69, 0x64, 0x07, 0x00,
+  0x09, 0x03, 0x6C, 0x74, 0x61, 0x07, 0x00, 0x09, 0x07, 0x72, 0x69, 0x65, 0x68, 0x61, 0x6D, 0x6E,
+  0x2F, 0x00, 0x08, 0x04, 0x69, 0x6E, 0x73, 0x6B, 0x25, 0x00, 0x08, 0x05, 0x6F, 0x6E, 0x61, 0x63,
+  0x6F, 0x07, 0x00, 0x09, 0x04, 0x73, 0x63, 0x6F, 0x77, 0x57, 0x00, 0x07, 0x07, 0x4E, 0x69, 0x63,
+  0x6F, 0x73, 0x69, 0x61, 0x2F, 0x00, 0x07, 0x04, 0x4F, 0x73, 0x6C, 0x6F, 0x07, 0x00, 0x07, 0x05,
+  0x50, 0x61, 0x72, 0x69, 0x73, 0x07, 0x00, 0x00, 0x10, 0x45, 0x75, 0x72, 0x6F, 0x70, 0x65, 0x5F,
+  0x50, 0x6F, 0x64, 0x67, 0x6F, 0x72, 0x69, 0x63, 0x61, 0x07, 0x00, 0x08, 0x05, 0x72, 0x61, 0x67,
+  0x75, 0x65, 0x07, 0x00, 0x07, 0x04, 0x52, 0x69, 0x67, 0x61, 0x2F, 0x00, 0x08, 0x03, 0x6F, 0x6D,
+  0x65, 0x07, 0x00, 0x07, 0x06, 0x53, 0x61, 0x6D, 0x61, 0x72, 0x61, 0x29, 0x00, 0x09, 0x08, 0x6E,
+  0x5F, 0x4D, 0x61, 0x72, 0x69, 0x6E, 0x6F, 0x07, 0x00, 0x09, 0x06, 0x72, 0x61, 0x6A, 0x65, 0x76,
+  0x6F, 0x07, 0x00, 0x0B, 0x03, 0x74, 0x6F, 0x76, 0x29, 0x00, 0x08, 0x09, 0x69, 0x6D, 0x66, 0x65,
+  0x72, 0x6F, 0x70, 0x6F, 0x6C, 0x57, 0x00, 0x08, 0x05, 0x6B, 0x6F, 0x70, 0x6A, 0x65, 0x07, 0x00,
+  0x08, 0x04, 0x6F, 0x66, 0x69, 0x61, 0x2F, 0x00, 0x08, 0x08, 0x74, 0x6F, 0x63, 0x6B, 0x68, 0x6F,
+  0x6C, 0x6D, 0x07, 0x00, 0x07, 0x07, 0x54, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x6E, 0x2F, 0x00, 0x08,
+  0x05, 0x69, 0x72, 0x61, 0x6E, 0x65, 0x07, 0x00, 0x0B, 0x04, 0x73, 0x70, 0x6F, 0x6C, 0x56, 0x00,
+  0x07, 0x09, 0x55, 0x6C, 0x79, 0x61, 0x6E, 0x6F, 0x76, 0x73, 0x6B, 0x29, 0x00, 0x00, 0x0F, 0x45,
+  0x75, 0x72, 0x6F, 0x70, 0x65, 0x5F, 0x55, 0x7A, 0x68, 0x67, 0x6F, 0x72, 0x6F, 0x64, 0x2F, 0x00,
+  0x0A, 0x05, 0x68, 0x6F, 0x72, 0x6F, 0x64, 0x2F, 0x00, 0x07, 0x05, 0x56, 0x61, 0x64, 0x75, 0x7A,
+  0x07, 0x00, 0x09, 0x05, 0x74, 0x69, 0x63, 0x61, 0x6E, 0x07, 0x00, 0x08, 0x05, 0x69, 0x65, 0x6E,
+  0x6E, 0x61, 0x07, 0x00, 0x09, 0x05, 0x6C, 0x6E, 0x69, 0x75, 0x73, 0x2F, 0x00, 0x08, 0x08, 0x6F,
+  0x6C, 0x67, 0x6F, 0x67, 0x72, 0x61, 0x64, 0x57, 0x00, 0x07, 0x06, 0x57, 0x61, 0x72, 0x73, 0x61,
+  0x77, 0x07, 0x00, 0x07, 0x06, 0x5A, 0x61, 0x67, 0x72, 0x65, 0x62, 0x07, 0x00, 0x09, 0x0A, 0x70,
+  0x6F, 0x72, 0x69, 0x7A, 0x68, 0x7A, 0x68, 0x69, 0x61, 0x2F, 0x00, 0x0C, 0x05, 0x6F, 0x7A, 0x68,
+  0x79, 0x65, 0x2F, 0x00, 0x08, 0x05, 0x75, 0x72, 0x69, 0x63, 0x68, 0x07, 0x00, 0x00, 0x07, 0x46,
+  0x61, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x58, 0x00, 0x00, 0x02, 0x47, 0x42, 0x55, 0x00, 0x02, 0x05,
+  0x6D, 0x45, 0x69, 0x72, 0x65, 0x55, 0x00, 0x01, 0x02, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x05, 0x47,
+  0x4D, 0x54, 0x70, 0x30, 0x00, 0x00, 0x03, 0x02, 0x6D, 0x30, 0x00, 0x00, 0x03, 0x01, 0x30, 0x00,
+  0x00, 0x01, 0x08, 0x72, 0x65, 0x65, 0x6E, 0x77, 0x69, 0x63, 0x68, 0x00, 0x00, 0x00, 0x03, 0x48,
+  0x53, 0x54, 0x59, 0x00, 0x01, 0x07, 0x6F, 0x6E, 0x67, 0x6B, 0x6F, 0x6E, 0x67, 0x31, 0x00, 0x00,
+  0x07, 0x49, 0x63, 0x65, 0x6C, 0x61, 0x6E, 0x64, 0x00, 0x00, 0x01, 0x12, 0x6E, 0x64, 0x69, 0x61,
+  0x6E, 0x5F, 0x41, 0x6E, 0x74, 0x61, 0x6E, 0x61, 0x6E, 0x61, 0x72, 0x69, 0x76, 0x6F, 0x01, 0x00,
+  0x07, 0x06, 0x43, 0x68, 0x61, 0x67, 0x6F, 0x73, 0x27, 0x00, 0x09, 0x07, 0x72, 0x69, 0x73, 0x74,
+  0x6D, 0x61, 0x73, 0x20, 0x00, 0x08, 0x04, 0x6F, 0x63, 0x6F, 0x73, 0x3C, 0x00, 0x09, 0x04, 0x6D,
+  0x6F, 0x72, 0x6F, 0x01, 0x00, 0x07, 0x09, 0x4B, 0x65, 0x72, 0x67, 0x75, 0x65, 0x6C, 0x65, 0x6E,
+  0x23, 0x00, 0x07, 0x04, 0x4D, 0x61, 0x68, 0x65, 0x29, 0x00, 0x09, 0x06, 0x6C, 0x64, 0x69, 0x76,
+  0x65, 0x73, 0x23, 0x00, 0x09, 0x07, 0x75, 0x72, 0x69, 0x74, 0x69, 0x75, 0x73, 0x29, 0x00, 0x00,
+  0x0E, 0x49, 0x6E, 0x64, 0x69, 0x61, 0x6E, 0x5F, 0x4D, 0x61, 0x79, 0x6F, 0x74, 0x74, 0x65, 0x01,
+  0x00, 0x07, 0x07, 0x52, 0x65, 0x75, 0x6E, 0x69, 0x6F, 0x6E, 0x29, 0x00, 0x01, 0x03, 0x72, 0x61,
+  0x6E, 0x3D, 0x00, 0x01, 0x05, 0x73, 0x72, 0x61, 0x65, 0x6C, 0x34, 0x00, 0x00, 0x07, 0x4A, 0x61,
+  0x6D, 0x61, 0x69, 0x63, 0x61, 0x0F, 0x00, 0x02, 0x03, 0x70, 0x61, 0x6E, 0x3E, 0x00, 0x00, 0x09,
+  0x4B, 0x77, 0x61, 0x6A, 0x61, 0x6C, 0x65, 0x69, 0x6E, 0x28, 0x00, 0x00, 0x05, 0x4C, 0x69, 0x62,
+  0x79, 0x61, 0x09, 0x00, 0x00, 0x03, 0x4D, 0x45, 0x54, 0x5A, 0x00, 0x01, 0x02, 0x53, 0x54, 0x15,
+  0x00, 0x03, 0x04, 0x37, 0x4D, 0x44, 0x54, 0x13, 0x00, 0x01, 0x0F, 0x65, 0x78, 0x69, 0x63, 0x6F,
+  0x5F, 0x42, 0x61, 0x6A, 0x61, 0x4E, 0x6F, 0x72, 0x74, 0x65, 0x17, 0x00, 0x0B, 0x03, 0x53, 0x75,
+  0x72, 0x15, 0x00, 0x07, 0x07, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x10, 0x00, 0x00, 0x02,
+  0x4E, 0x5A, 0x24, 0x00, 0x02, 0x05, 0x6D, 0x43, 0x48, 0x41, 0x54, 0x5B, 0x00, 0x00, 0x06, 0x4E,
+  0x61, 0x76, 0x61, 0x6A, 0x6F, 0x13, 0x00, 0x00, 0x03, 0x50, 0x52, 0x43, 0x2D, 0x00, 0x01, 0x06,
+  0x53, 0x54, 0x38, 0x50, 0x44, 0x54, 0x17, 0x00, 0x01, 0x0B, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63,
+  0x5F, 0x41, 0x70, 0x69, 0x61, 0x51, 0x00, 0x09, 0x07, 0x75, 0x63, 0x6B, 0x6C, 0x61, 0x6E, 0x64,
+  0x24, 0x00, 0x08, 0x0C, 0x42, 0x6F, 0x75, 0x67, 0x61, 0x69, 0x6E, 0x76, 0x69, 0x6C, 0x6C, 0x65,
+  0x38, 0x00, 0x08, 0x07, 0x43, 0x68, 0x61, 0x74, 0x68, 0x61, 0x6D, 0x5B, 0x00, 0x0A, 0x03, 0x75,
+  0x75, 0x6B, 0x21, 0x00, 0x08, 0x06, 0x45, 0x61, 0x73, 0x74, 0x65, 0x72, 0x48, 0x00, 0x09, 0x04,
+  0x66, 0x61, 0x74, 0x65, 0x38, 0x00, 0x09, 0x08, 0x6E, 0x64, 0x65, 0x72, 0x62, 0x75, 0x72, 0x79,
+  0x51, 0x00, 0x08, 0x07, 0x46, 0x61, 0x6B, 0x61, 0x6F, 0x66, 0x6F, 0x51, 0x00, 0x09, 0x03, 0x69,
+  0x6A, 0x69, 0x28, 0x00, 0x09, 0x07, 0x75, 0x6E, 0x61, 0x66, 0x75, 0x74, 0x69, 0x28, 0x00, 0x08,
+  0x09, 0x47, 0x61, 0x6C, 0x61, 0x70, 0x61, 0x67, 0x6F, 0x73, 0x4D, 0x00, 0x0A, 0x05, 0x6D, 0x62,
+  0x69, 0x65, 0x72, 0x50, 0x00, 0x00, 0x13, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x5F, 0x47,
+  0x75, 0x61, 0x64, 0x61, 0x6C, 0x63, 0x61, 0x6E, 0x61, 0x6C, 0x38, 0x00, 0x0B, 0x01, 0x6D, 0x5C,
+  0x00, 0x08, 0x08, 0x48, 0x6F, 0x6E, 0x6F, 0x6C, 0x75, 0x6C, 0x75, 0x59, 0x00, 0x08, 0x08, 0x4A,
+  0x6F, 0x68, 0x6E, 0x73, 0x74, 0x6F, 0x6E, 0x59, 0x00, 0x08, 0x06, 0x4B, 0x61, 0x6E, 0x74, 0x6F,
+  0x6E, 0x51, 0x00, 0x09, 0x09, 0x69, 0x72, 0x69, 0x74, 0x69, 0x6D, 0x61, 0x74, 0x69, 0x52, 0x00,
+  0x09, 0x05, 0x6F, 0x73, 0x72, 0x61, 0x65, 0x38, 0x00, 0x09, 0x08, 0x77, 0x61, 0x6A, 0x61, 0x6C,
+  0x65, 0x69, 0x6E, 0x28, 0x00, 0x08, 0x06, 0x4D, 0x61, 0x6A, 0x75, 0x72, 0x6F, 0x28, 0x00, 0x0A,
+  0x07, 0x72, 0x71, 0x75, 0x65, 0x73, 0x61, 0x73, 0x5D, 0x00, 0x09, 0x05, 0x69, 0x64, 0x77, 0x61,
+  0x79, 0x5E, 0x00, 0x08, 0x05, 0x4E, 0x61, 0x75, 0x72, 0x75, 0x28, 0x00, 0x09, 0x03, 0x69, 0x75,
+  0x65, 0x4B, 0x00, 0x09, 0x06, 0x6F, 0x72, 0x66, 0x6F, 0x6C, 0x6B, 0x5F, 0x00, 0x0A, 0x04, 0x75,
+  0x6D, 0x65, 0x61, 0x38, 0x00, 0x08, 0x09, 0x50, 0x61, 0x67, 0x6F, 0x5F, 0x50, 0x61, 0x67, 0x6F,
+  0x5E, 0x00, 0x00, 0x0D, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x5F, 0x50, 0x61, 0x6C, 0x61,
+  0x75, 0x2C, 0x00, 0x09, 0x07, 0x69, 0x74, 0x63, 0x61, 0x69, 0x72, 0x6E, 0x4F, 0x00, 0x09, 0x06,
+  0x6F, 0x68, 0x6E, 0x70, 0x65, 0x69, 0x38, 0x00, 0x0A, 0x04, 0x6E, 0x61, 0x70, 0x65, 0x38, 0x00,
+  0x0A, 0x0A, 0x72, 0x74, 0x5F, 0x4D, 0x6F, 0x72, 0x65, 0x73, 0x62, 0x79, 0x21, 0x00, 0x08, 0x09,
+  0x52, 0x61, 0x72, 0x6F, 0x74, 0x6F, 0x6E, 0x67, 0x61, 0x4A, 0x00, 0x08, 0x06, 0x53, 0x61, 0x69,
+  0x70, 0x61, 0x6E, 0x5C, 0x00, 0x0A, 0x03, 0x6D, 0x6F, 0x61, 0x5E, 0x00, 0x08, 0x06, 0x54, 0x61,
+  0x68, 0x69, 0x74, 0x69, 0x4A, 0x00, 0x0A, 0x04, 0x72, 0x61, 0x77, 0x61, 0x28, 0x00, 0x09, 0x08,
+  0x6F, 0x6E, 0x67, 0x61, 0x74, 0x61, 0x70, 0x75, 0x51, 0x00, 0x09, 0x03, 0x72, 0x75, 0x6B, 0x21,
+  0x00, 0x08, 0x04, 0x57, 0x61, 0x6B, 0x65, 0x28, 0x00, 0x0A, 0x04, 0x6C, 0x6C, 0x69, 0x73, 0x28,
+  0x00, 0x08, 0x03, 0x59, 0x61, 0x70, 0x21, 0x00, 0x01, 0x05, 0x6F, 0x6C, 0x61, 0x6E, 0x64, 0x07,
+  0x00, 0x00, 0x08, 0x50, 0x6F, 0x72, 0x74, 0x75, 0x67, 0x61, 0x6C, 0x40, 0x00, 0x00, 0x03, 0x52,
+  0x4F, 0x43, 0x2D, 0x00, 0x02, 0x01, 0x4B, 0x3B, 0x00, 0x00, 0x09, 0x53, 0x69, 0x6E, 0x67, 0x61,
+  0x70, 0x6F, 0x72, 0x65, 0x1F, 0x00, 0x00, 0x06, 0x54, 0x75, 0x72, 0x6B, 0x65, 0x79, 0x25, 0x00,
+  0x00, 0x03, 0x55, 0x43, 0x54, 0x54, 0x00, 0x01, 0x08, 0x53, 0x5F, 0x41, 0x6C, 0x61, 0x73, 0x6B,
+  0x61, 0x0B, 0x00, 0x05, 0x06, 0x65, 0x75, 0x74, 0x69, 0x61, 0x6E, 0x0A, 0x00, 0x04, 0x06, 0x72,
+  0x69, 0x7A, 0x6F, 0x6E, 0x61, 0x15, 0x00, 0x03, 0x07, 0x43, 0x65, 0x6E, 0x74, 0x72, 0x61, 0x6C,
+  0x14, 0x00, 0x03, 0x0C, 0x45, 0x61, 0x73, 0x74, 0x6D, 0x49, 0x6E, 0x64, 0x69, 0x61, 0x6E, 0x61,
+  0x16, 0x00, 0x07, 0x03, 0x65, 0x72, 0x6E, 0x16, 0x00, 0x03, 0x06, 0x48, 0x61, 0x77, 0x61, 0x69,
+  0x69, 0x59, 0x00, 0x03, 0x0E, 0x49, 0x6E, 0x64, 0x69, 0x61, 0x6E, 0x61, 0x6D, 0x53, 0x74, 0x61,
+  0x72, 0x6B, 0x65, 0x14, 0x00, 0x03, 0x08, 0x4D, 0x69, 0x63, 0x68, 0x69, 0x67, 0x61, 0x6E, 0x16,
+  0x00, 0x04, 0x07, 0x6F, 0x75, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x13, 0x00, 0x00, 0x0A, 0x55, 0x53,
+  0x5F, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x17, 0x00, 0x03, 0x05, 0x53, 0x61, 0x6D, 0x6F,
+  0x61, 0x5E, 0x00, 0x01, 0x02, 0x54, 0x43, 0x54, 0x00, 0x01, 0x08, 0x6E, 0x69, 0x76, 0x65, 0x72,
+  0x73, 0x61, 0x6C, 0x54, 0x00, 0x00, 0x04, 0x57, 0x6D, 0x53, 0x55, 0x57, 0x00, 0x01, 0x02, 0x45,
+  0x54, 0x40, 0x00, 0x00, 0x04, 0x5A, 0x75, 0x6C, 0x75, 0x54, 0x00,
+};
+
+static const uint16_t tzTableValues[] = {
+  0, 5, 11, 17, 23, 29, 59, 67, 94, 101, 107, 131,
+  156, 161, 168, 199, 204, 209, 216, 223, 246, 269, 274, 297,
+  320, 343, 375, 402, 429, 436, 468, 494, 502, 510, 519, 548,
+  556, 584, 592, 625, 633, 642, 650, 679, 688, 696, 702, 715,
+  744, 775, 781, 787, 793, 820, 833, 839, 852, 861, 868, 874,
+  880, 893, 906, 912, 943, 969, 976, 1007, 1015, 1025, 1038, 1075,
+  1082, 1114, 1141, 1149, 1157, 1165, 1172, 1179, 1186, 1193, 1202, 1211,
+  1219, 1224, 1249, 1276, 1282, 1289, 1295, 1322, 1367, 1375, 1387, 1393,
+};
+
+static const char tzTableValueData[] =
+  "GMT0\000"
+  "EAT-3\000"
+  "CET-1\000"
+  "WAT-1\000"
+  "CAT-2\000"
+  "EET-2EEST,M4.5.5/0,M10.5.4/24\000"
+  "<+01>-1\000"
+  "CET-1CEST,M3.5.0,M10.5.0/3\000"
+  "SAST-2\000"
+  "EET-2\000"
+  "HST10HDT,M3.2.0,M11.1.0\000"
+  "AKST9AKDT,M3.2.0,M11.1.0\000"
+  "AST4\000"
+  "<-03>3\000"
+  "<-04>4<-03>,M10.1.0/0,M3.4.0/0\000"
+  "EST5\000"
+  "CST6\000"
+  "<-04>4\000"
+  "<-05>5\000"
+  "MST7MDT,M3.2.0,M11.1.0\000"
+  "CST6CDT,M3.2.0,M11.1.0\000"
+  "MST7\000"
+  "EST5EDT,M3.2.0,M11.1.0\000"
+  "PST8PDT,M3.2.0,M11.1.0\000"
+  "AST4ADT,M3.2.0,M11.1.0\000"
+  "<-02>2<-01>,M3.5.0/-1,M10.5.0/0\000"
+  "CST5CDT,M3.2.0/0,M11.1.0/1\000"
+  "<-03>3<-02>,M3.2.0,M11.1.0\000"
+  "<-02>2\000"
+  "<-04>4<-03>,M9.1.6/24,M4.1.6/24\000"
+  "NST3:30NDT,M3.2.0,M11.1.0\000"
+  "<+08>-8\000"
+  "<+07>-7\000"
+  "<+10>-10\000"
+  "AEST-10AEDT,M10.1.0,M4.1.0/3\000"
+  "<+05>-5\000"
+  "NZST-12NZDT,M9.5.0,M4.1.0/3\000"
+  "<+03>-3\000"
+  "<+00>0<+02>-2,M3.5.0/1,M10.5.0/3\000"
+  "<+06>-6\000"
+  "<+12>-12\000"
+  "<+04>-4\000"
+  "EET-2EEST,M3.5.0/0,M10.5.0/0\000"
+  "IST-5:30\000"
+  "<+09>-9\000"
+  "CST-8\000"
+  "<+0530>-5:30\000"
+  "EET-2EEST,M3.5.0/3,M10.5.0/4\000"
+  "EET-2EEST,M3.4.4/50,M10.4.4/50\000"
+  "HKT-8\000"
+  "WIB-7\000"
+  "WIT-9\000"
+  "IST-2IDT,M3.4.4/26,M10.5.0\000"
+  "<+0430>-4:30\000"
+  "PKT-5\000"
+  "<+0545>-5:45\000"
+  "<+11>-11\000"
+  "WITA-8\000"
+  "PST-8\000"
+  "KST-9\000"
+  "<+0630>-6:30\000"
+  "<+0330>-3:30\000"
+  "JST-9\000"
+  "<-01>1<+00>,M3.5.0/0,M10.5.0/1\000"
+  "WET0WEST,M3.5.0/1,M10.5.0\000"
+  "<-01>1\000"
+  "ACST-9:30ACDT,M10.1.0,M4.1.0/3\000"
+  "AEST-10\000"
+  "ACST-9:30\000"
+  "<+0845>-8:45\000"
+  "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0\000"
+  "AWST-8\000"
+  "<-06>6<-05>,M9.1.6/22,M4.1.6/22\000"
+  "IST-1GMT0,M10.5.0,M3.5.0/1\000"
+  "<-10>10\000"
+  "<-11>11\000"
+  "<-12>12\000"
+  "<-06>6\000"
+  "<-07>7\000"
+  "<-08>8\000"
+  "<-09>9\000"
+  "<+13>-13\000"
+  "<+14>-14\000"
+  "<+02>-2\000"
+  "UTC0\000"
+  "GMT0BST,M3.5.0/1,M10.5.0\000"
+  "EET-2EEST,M3.5.0,M10.5.0/3\000"
+  "MSK-3\000"
+  "<-00>0\000"
+  "HST10\000"
+  "MET-1MEST,M3.5.0,M10.5.0/3\000"
+  "<+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45\000"
+  "ChST-10\000"
+  "<-0930>9:30\000"
+  "SST11\000"
+  "<+11>-11<+12>,M10.1.0,M4.1.0/3\000";
+
+static const MinuStringTable tzTable = {599, tzTableBuckets, tzTableTexts, 96, tzTableValues, tzTableValueData};
@@ -1,12 +1,17 @@
 #include "M5StickCPlus2.h"
 #include <WiFi.h>
-#include "ESP32Ping.h"
 #include <ArduinoUniqueID.h>
+#include <algorithm>
 
 #include "../../minu.hpp"
+#include "../../minu_loop.hpp"
+#include "../../minu_strtab.hpp"
+#include "../../minu_probe.hpp"
+#include "../../minu_time.hpp"
 #include "ui.h"
 #include "utils.h"
 #include "config.h"
+#include "tz_table.h"   // Timezones of TZ.h, compressed by extras/strtab
 
 #if CONFIG_FREERTOS_UNICORE
 #define ARDUINO_RUNNING_CORE 0
@@ -14,14 +19,6 @@
 #define ARDUINO_RUNNING_CORE 1
 #endif
 
-/// @brief Defines the data to be fetched periodically
-typedef enum
-{
-  UI_UPDATE_TYPE_TIME = 1,
-  UI_UPDATE_TYPE_FOB_INFO,
-  UI_UPDATE_TYPE_PING,
-} UiUpdateType;
-
 /// @brief Information about a Wi-Fi network found during a Wi-Fi scan
 typedef struct
 {
@@ -32,10 +29,9 @@ typedef struct
   int channel;
 } UiWiFiScannedNetwork;
 
-TaskHandle_t screenWatchTaskHandle = NULL;
-TaskHandle_t screenUpdateTaskHandle = NULL;
+TaskHandle_t uiLoopTaskHandle = NULL;
 TaskHandle_t buttonWatchTaskHandle = NULL;
-TaskHandle_t dataUpdateTaskHandle = NULL;
+TaskHandle_t probeTaskHandle = NULL;
 
 size_t homePageId;
 size_t wifiPageId;
@@ -43,24 +39,38 @@ size_t scanResultPageId;
 size_t pingTargetsPageId;
 size_t timePageId;
 size_t fobInfoPageId;
+size_t timezonePageId;
 
 static size_t wifiStatusItem;
 static ssize_t homepageWifiItem;
 
 long lastButtonADownTime = 0;
 long lastButtonBDownTime = 0;
+bool buttonBHeld = false;
 long lastButtonCDownTime = 0;
 long currentTime = 0;
-bool longPressA;
-bool longPressB;
-bool longPressC;
-bool shortPressA;
-bool shortPressB;
+
+/// @brief Processes button presses and renders the menu, sleeping while there is nothing to do
+MinuEventLoop<> uiLoop(menu, MINU_ITEM_MAX_COUNT);
+
+/// @brief Page and item callbacks, which the UI loop runs after rendering the result of a button press
+MinuDeferredCallbacks uiCallbacks;
+
+/// @brief Items of the timezone page, decoded from the compressed table as they are shown
+MinuStringTableSource timezoneSource(tzTable);
+
+/// @brief Date and time shown on the time page, formatted once per second
+MinuTimeService<> timeService("%H:%M:%SH", "%d/%m/%Y");
+
+/// @brief Pings all ping targets at once while their page is open, from the probe task
+MinuProbeEngine<MinuSocketTransport> pingProbes;
 
 void buttonWatchTask(void *arg);
-void screenWatchTask(void *arg);
-void screenUpdateTask(void *arg);
-void dataUpdateTask(void *arg);
+void uiLoopTask(void *arg);
+void probeTask(void *arg);
+#ifdef UI_DEBUG_LOG
+void logMemoryUsage(void *arg);
+#endif
 
 void goToFobInfoPage(void *arg = NULL)
 {
@@ -92,6 +102,19 @@ void goToPingTargetsPage(void *arg = NULL)
   menu.goToPage(pingTargetsPageId);
 }
 
+void goToTimezonePage(void *arg = NULL)
+{
+  menu.goToPage(timezonePageId);
+}
+
+/// @brief Switches to the timezone of the selected item, and shows the time in it
+/// @param arg A pointer to the selected item, whose id is its index in the timezone table
+void selectTimezone(void *arg)
+{
+  timeService.setTimezone(minuStrtabValue(tzTable, ((MinuPageItem *)arg)->id()));
+  goToTimePage();
+}
+
 /// @brief Generic function to be called just after the current active page changes
 /// @param arg A pointer to the currently active page is passed
 void pageOpenedCallback(void *arg)
@@ -137,17 +160,19 @@ void updateWiFiItem(void *arg)
 
   MinuPageItem *thisItem = (MinuPageItem *)arg;
 
+  // The callback runs after the item was highlighted on screen. Setting the status through the UI loop
+  // has the menu rendered again, but only if the status changed
   if (WiFi.getMode() == WIFI_MODE_AP)
-    thisItem->setAuxTextBackground(GREEN);
+    uiLoop.setStatus(*thisItem, MINU_STATUS_OK, MINU_FOREGROUND_COLOUR_DEFAULT, GREEN);
   else if (WiFi.getMode() == WIFI_MODE_STA)
   {
     if (WiFi.status() == WL_CONNECTED)
-      thisItem->setAuxTextBackground(GREEN);
+      uiLoop.setStatus(*thisItem, MINU_STATUS_OK, MINU_FOREGROUND_COLOUR_DEFAULT, GREEN);
     else
-      thisItem->setAuxTextBackground(RED);
+      uiLoop.setStatus(*thisItem, MINU_STATUS_ERROR, MINU_FOREGROUND_COLOUR_DEFAULT, RED);
   }
   else
-    thisItem->setAuxTextBackground(TFT_GREY);
+    uiLoop.setStatus(*thisItem, MINU_STATUS_NONE, MINU_FOREGROUND_COLOUR_DEFAULT, TFT_GREY);
 }
 
 /// @brief Prints the Wi-Fi status and details when the Wi-Fi status item (<--) on the Wi-Fi page is highlighted
@@ -187,87 +212,90 @@ void lcdPrintWiFiStatus(void *page)
   M5.Lcd.setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
 }
 
-/// @brief Sync RTC time with NTP server and RTC time
-void lcdPrintTime(void *arg = NULL)
+/// @brief Refresh the time page just after each second starts, until the page is closed
+/// @note  The time service writes the time to the canvas cells bound to it, and only the digits that changed are printed
+void timeTick(void *arg = NULL)
 {
-	syncNtpToRtc(TIMEZONE);
-  auto dt = M5.Rtc.getDateTime();
-  Serial.printf("%02d:%02d:%02dH\n%02d/%02d/%04d\n",
-                dt.time.hours, dt.time.minutes, dt.time.seconds,
-                dt.date.date, dt.date.month, dt.date.year);
-  M5.Lcd.printf("%02d:%02d:%02dH\n%02d/%02d/%04d\n",
-                dt.time.hours, dt.time.minutes, dt.time.seconds,
-                dt.date.date, dt.date.month, dt.date.year);
+  timeService.update();
+  uiLoop.addPageTimeout(timePageId, timeService.msToNextSecond(), timeTick);
 }
 
-/// @brief Print information about the fob's current status
-void lcdPrintFobInfo(void *arg = NULL)
+/// @brief Run the RTC sync requested by the SNTP notification, if any
+void pollTimeSync(void *arg = NULL)
 {
-  M5.Lcd.printf("Name:" MINU_FOB_NAME "\n");
-  M5.Lcd.printf("Time:%ld\n", millis());
-  M5.Lcd.printf("HWID:0x");
+  timeService.sync();
+}
+
+/// @brief Write information about the fob's current status to the info page canvas
+void canvasPrintFobInfo(void *arg = NULL)
+{
+  MinuTextCanvas &canvas = menu.canvas();
+  canvas.clear();
+  canvas.print("Name:" MINU_FOB_NAME "\n");
+  canvas.printf("Time:%ld\n", millis());
+  canvas.print("HWID:0x");
   for (size_t i = 0; i < UniqueIDsize; i++)
-    M5.Lcd.print(UniqueID[i], HEX);
-  M5.Lcd.printf("\nBATT:%u%%\n", M5.Power.getBatteryLevel());
+    canvas.printf("%X", UniqueID[i]);
+  canvas.printf("\nBATT:%u%%\n", M5.Power.getBatteryLevel());
 }
 
-/// @brief Stop the task that periodically performs HTTP requests
+/// @brief Stop pinging the ping targets. The probe task then sleeps until their page is opened again
 void stopDataUpdate(void *arg = NULL)
 {
-  if (dataUpdateTaskHandle)
-  {
-    vTaskDelete(dataUpdateTaskHandle);
-    dataUpdateTaskHandle = NULL;
-  }
+  pingProbes.stop();
 }
 
-/// @brief Check whether ping targets can be reached
-void updatePingTargetsStatus(void *arg = NULL)
+/// @brief Show whether a ping target can be reached, as soon as an echo to it is answered or it is found unreachable
+/// @note  Called from the probe task. Item statuses can be set from it while the UI loop renders them
+void publishPingResult(size_t target, const MinuProbeResult &result, void *arg)
 {
-  size_t targetCount = pingTargets.size();
-  Serial.printf("Pinging %d targets...\n", targetCount);
+  pingTargets[target].pingOK = (result.state == MINU_PROBE_UP);
+  pingTargets[target].pinged = true;
 
-  for (size_t i = 0; i < targetCount; ++i)
-  {
-    if (pingTargets[i].useIP)
-      pingTargets[i].pingOK = Ping.ping(pingTargets[i].pingIP, 5);
-    else
-      pingTargets[i].pingOK = Ping.ping(pingTargets[i].fqn.c_str(), 5);
-    pingTargets[i].pinged = true;
-
-    if (pingTargets[i].pingOK)
-      menu.pages()[pingTargetsPageId]->items()[i].setAuxTextBackground(GREEN);
-    else
-      menu.pages()[pingTargetsPageId]->items()[i].setAuxTextBackground(RED);
-    Serial.printf("Target %d(%s) -> ping %s\n", i, pingTargets[i].pingIP.toString().c_str(), (pingTargets[i].pingOK) ? "OK" : "FAIL");
-    if (screenUpdateTaskHandle)
-      xTaskNotify(screenUpdateTaskHandle, 1, eSetValueWithOverwrite);
-  }
+  MinuPageItem &item = menu.pages()[pingTargetsPageId]->items()[target];
+  if (pingTargets[target].pingOK)
+    uiLoop.setStatus(item, MINU_STATUS_OK, MINU_FOREGROUND_COLOUR_DEFAULT, GREEN);
+  else
+    uiLoop.setStatus(item, MINU_STATUS_ERROR, MINU_FOREGROUND_COLOUR_DEFAULT, RED);
+#ifdef UI_DEBUG_LOG
+  Serial.printf("Target %d(%s) -> ping %s, %ums\n", target, pingTargets[target].displayHostname.c_str(),
+                (pingTargets[target].pingOK) ? "OK" : "FAIL", result.rttMs);
+#endif
 }
 
-/// @brief Starts the task that periodically performs HTTP requests
+/// @brief Starts refreshing the current page
+/// @note  Info pages only write to the menu canvas, which is cheap enough to do on the UI loop. Their updaters are
+///        removed by the loop once the page is closed. Ping targets are pinged from a task of their own, as resolving
+///        their names blocks until the DNS server answers
 void startDataUpdate(void *arg = NULL)
 {
-  UiUpdateType ut;
   if (menu.currentPageId() == timePageId)
-    ut = UI_UPDATE_TYPE_TIME;
-  else if (menu.currentPageId() == fobInfoPageId)
-    ut = UI_UPDATE_TYPE_FOB_INFO;
-  else if (menu.currentPageId() == pingTargetsPageId)
   {
-    ut = UI_UPDATE_TYPE_PING;
-    for (auto item : menu.currentPage()->items())
-      item.setAuxTextBackground(MINU_BACKGROUND_COLOUR_DEFAULT);
-    menu.currentPage()->highlightItem(0);
-    if (screenUpdateTaskHandle)
-      xTaskNotify(screenUpdateTaskHandle, 1, eSetValueWithOverwrite);
+    // The canvas was cleared when the page changed, so the time is written again even if the second has not turned
+    timeService.update(true);
+    uiLoop.addPageTimeout(timePageId, timeService.msToNextSecond(), timeTick);
+    return;
   }
-  else
+  if (menu.currentPageId() == fobInfoPageId)
+  {
+    canvasPrintFobInfo();
+    uiLoop.addPageUpdater(fobInfoPageId, 1000, canvasPrintFobInfo, NULL, 50);
+    return;
+  }
+  if (menu.currentPageId() != pingTargetsPageId)
     return;
 
-  // If the data update task is already running, delete and create it afresh
-  stopDataUpdate();
-  xTaskCreatePinnedToCore(dataUpdateTask, "Data Update", 4096, (void *)ut, 2, &dataUpdateTaskHandle, ARDUINO_RUNNING_CORE);
+  for (size_t i = 0; i < pingTargets.size(); ++i)
+    menu.currentPage()->items()[i].setStatus(MINU_STATUS_NONE, MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+  menu.currentPage()->highlightItem(0);
+  uiLoop.requestRender();
+
+  // Results of the last visit are forgotten, and all targets are pinged at once
+  pingProbes.start();
+  if (probeTaskHandle)
+    xTaskNotifyGive(probeTaskHandle);
+  else
+    xTaskCreatePinnedToCore(probeTask, "Probe", 4096, NULL, 2, &probeTaskHandle, ARDUINO_RUNNING_CORE);
 }
 
 void startWiFiSTA(void *arg = NULL)
@@ -310,47 +338,184 @@ void deleteAllPageItems(void *arg)
   thisPage->removeAllItems();
 }
 
+#ifdef MINU_HAS_ACTIONS
+/// @brief Keys of the scan result page's status line and back link. Networks are keyed by their BSSID
+#define SCAN_STATUS_KEY 0
+#define SCAN_BACK_KEY   1
+
+/// @brief  Make the scan result page show the results of the last scan, strongest first
+/// @note   Networks still in range keep their items, so only the ones that appeared, disappeared or changed RSSI
+///         are redrawn, and the highlight stays on the same network
+/// @return The number of items that changed
+size_t reconcileScanResults(MinuPage *page, int n, const char *status)
+{
+  std::vector<int> order;
+  for (int i = 0; i < n; ++i)
+    order.push_back(i);
+  std::sort(order.begin(), order.end(), [](int a, int b) { return WiFi.RSSI(a) > WiFi.RSSI(b); });
+  if (order.size() > WIFI_SCAN_RESULT_MAX)
+    order.resize(WIFI_SCAN_RESULT_MAX);
+
+  // The texts must outlive the specs, so they are all read before any spec points to them
+  std::vector<String> ssids, levels;
+  for (int i : order)
+  {
+    ssids.push_back(WiFi.SSID(i));
+    levels.push_back(String(WiFi.RSSI(i)));
+  }
+
+  std::vector<MinuItemSpec> specs;
+  specs.push_back(MinuItemSpec(SCAN_STATUS_KEY, NULL, status, NULL));
+  for (size_t i = 0; i < order.size(); ++i)
+    specs.push_back(MinuItemSpec(minuKey(WiFi.BSSIDstr(order[i]).c_str()), NULL, ssids[i].c_str(), levels[i].c_str()));
+  specs.push_back(MinuItemSpec(SCAN_BACK_KEY, goToWiFiPage, "<--", NULL));
+  return page->reconcile(specs.data(), specs.size());
+}
+
+/// @brief Perform a Wi-Fi scan without blocking the UI loop, showing progress on the scan result page
+MinuAction wifiScanAction(void)
+{
+  MinuPage *page = menu.pages()[scanResultPageId];
+  goToScanResultPage();
+  page->addItem(NULL, "Scanning...", NULL);
+  page->items()[0].setKey(SCAN_STATUS_KEY);
+  co_await MinuNextFrame();
+
+  WiFi.mode(WIFI_MODE_NULL);
+  co_await MinuSleep(100);
+  WiFi.mode(WIFI_MODE_STA);
+
+  // Channels are scanned one at a time, and the networks found on each are shown strongest first as soon as it
+  // completes. Leaving the page cancels the action at one of these waits
+  char status[MINU_MAIN_TEXT_LEN + 1];
+  int found = 0;
+  for (uint8_t channel = 1; channel <= WIFI_SCAN_CHANNELS; ++channel)
+  {
+    WiFi.scanNetworks(true, false, false, 300, channel);
+    int n;
+    while ((n = WiFi.scanComplete()) == WIFI_SCAN_RUNNING)
+      co_await MinuSleep(50);
+
+    if (n < 0)
+    {
+      snprintf(status, sizeof(status), "Scan error %d!", n);
+      page->items()[0].setMainText(status);
+      break;
+    }
+
+    // Networks are keyed by BSSID from the start, so that the rescans below can reconcile with them
+    for (int i = 0; i < n; ++i)
+    {
+      ssize_t index = page->insertItem(WiFi.RSSI(i), NULL, WiFi.SSID(i).c_str(), String(WiFi.RSSI(i)).c_str());
+      if (index >= 0)
+        page->items()[index].setKey(minuKey(WiFi.BSSIDstr(i).c_str()));
+    }
+    WiFi.scanDelete();
+    found += n;
+
+    if (channel < WIFI_SCAN_CHANNELS)
+      snprintf(status, sizeof(status), "Ch %u: %d found", channel, found);
+    else
+      snprintf(status, sizeof(status), "Scan: %d found", found);
+    page->items()[0].setMainText(status);
+    uiLoop.requestRender();
+    co_await MinuNextFrame();
+  }
+
+  co_await MinuSleep(3000);
+  page->addItem(goToWiFiPage, "<--", NULL);
+  page->items().back().setKey(SCAN_BACK_KEY);
+  uiLoop.requestRender();
+
+  // The list is kept up to date until the page is closed, which cancels the action
+  while (true)
+  {
+    co_await MinuSleep(WIFI_SCAN_REFRESH_MS);
+    WiFi.scanNetworks(true);
+    int n;
+    while ((n = WiFi.scanComplete()) == WIFI_SCAN_RUNNING)
+      co_await MinuSleep(100);
+    if (n < 0)
+      continue;
+
+    snprintf(status, sizeof(status), "Scan: %d found", n);
+    if (reconcileScanResults(page, n, status))
+      uiLoop.requestRender();
+    WiFi.scanDelete();
+  }
+}
+
+/// @brief Start a Wi-Fi scan
+void startWiFiScan(void *arg)
+{
+  uiLoop.startAction(wifiScanAction());
+}
+#else
 /// @brief Perform a Wi-Fi scan
 void startWiFiScan(void *arg)
 {
+  // Links run on the UI loop task, so the page is rendered here rather than waiting for the loop to do it
   goToScanResultPage();
-  if (screenUpdateTaskHandle)
-    xTaskNotify(screenUpdateTaskHandle, 1, eSetValueWithOverwrite);
-  while (!menu.rendered())
-    delay(10);
-  const int cursorX = M5.Lcd.getCursorX();
-  const int cursorY = M5.Lcd.getCursorY();
+  uiLoop.renderNow();
 
   WiFi.mode(WIFI_MODE_NULL);
   delay(100);
   WiFi.mode(WIFI_MODE_STA);
 
-  M5.Lcd.println("Scanning...");
-  int n = WiFi.scanNetworks();
-  M5.Lcd.setCursor(cursorX, cursorY);
-  M5.Lcd.print("Scan ");
-
-  if (n == 0)
-    M5.Lcd.println("done. 0 found.");
-  else if (n < 0)
-    M5.Lcd.printf("error %d!\n", n);
-  else if (n > 0)
+  // Channels are scanned one at a time, and the page is rendered after each with the networks found so far,
+  // strongest first. Progress is printed below the items
+  int found = 0;
+  for (uint8_t channel = 1; channel <= WIFI_SCAN_CHANNELS; ++channel)
   {
-    M5.Lcd.printf("done. %d found\n", n);
+    const int cursorX = M5.Lcd.getCursorX();
+    const int cursorY = M5.Lcd.getCursorY();
+    M5.Lcd.printf("Scanning ch %u...\n", channel);
+    int n = WiFi.scanNetworks(false, false, false, 300, channel);
+    M5.Lcd.setCursor(cursorX, cursorY);
+    if (n < 0)
+    {
+      M5.Lcd.printf("Scan error %d!   \n", n);
+      break;
+    }
 
     for (int i = 0; i < n; ++i)
-      menu.pages()[scanResultPageId]->addItem(NULL, WiFi.SSID(i).c_str(), String(WiFi.RSSI(i)).c_str());
-
+      menu.pages()[scanResultPageId]->insertItem(WiFi.RSSI(i), NULL, WiFi.SSID(i).c_str(), String(WiFi.RSSI(i)).c_str());
     WiFi.scanDelete();
+    found += n;
+    uiLoop.renderNow();
   }
+  M5.Lcd.printf("Scan done. %d found\n", found);
     
   delay(3000);
   menu.pages()[scanResultPageId]->addItem(goToWiFiPage, "<--", NULL);
-  if (screenUpdateTaskHandle)
-    xTaskNotify(screenUpdateTaskHandle, 1, eSetValueWithOverwrite);
-    
-  while (!menu.rendered())
-    delay(10);
+  uiLoop.renderNow();
+}
+#endif
+
+/// @brief Clear the screen before the menu is rendered
+void clearScreen(void *arg)
+{
+  M5.Lcd.clear();
+  M5.Lcd.setCursor(0, 0);
+  M5.Lcd.setTextSize(TEXT_SIZE_DEFAULT);
+}
+
+/// @brief Pass a button press to the UI loop
+void uiPostInput(uint8_t event)
+{
+#ifdef UI_BEEP
+  M5.Speaker.tone((event == MINU_INPUT_SELECT) ? 5000 : 8000, 30);
+#endif
+  uiLoop.post(event);
+}
+
+/// @brief Adds the items and callbacks of the fob info page when it is opened
+void buildFobInfoPage(void *page)
+{
+  MinuPage *fobInfoPage = (MinuPage *)page;
+  fobInfoPage->addItem(goToHomePage, NULL, NULL);
+  fobInfoPage->setOpenedCallback(startDataUpdate);
+  fobInfoPage->setRenderedCallback(pageRenderedCallback);
 }
 
 void uiMenuInit(void)
@@ -359,6 +524,7 @@ void uiMenuInit(void)
   homepageWifiItem = homePage.addItem(goToWiFiPage, "Wi-Fi", " ", updateWiFiItem);
   homePage.addItem(goToPingTargetsPage, "Ping targets", NULL);
   homePage.addItem(goToTimePage, "Time", NULL);
+  homePage.addItem(goToTimezonePage, "Timezone", NULL);
   homePage.addItem(goToFobInfoPage, "Fob Info", NULL);
   homePage.setOpenedCallback(pageOpenedCallback);
   homePage.setClosedCallback(pageClosedCallback);
@@ -376,6 +542,7 @@ void uiMenuInit(void)
   wifiPageId = menu.addPage(wifiPage);
 
   MinuPage scanResultPage("SCAN RESULT", menu.numPages());
+  scanResultPage.setSorting(true, WIFI_SCAN_RESULT_MAX);   // Keyed by RSSI, so the strongest networks come first
   scanResultPage.setOpenedCallback(pageOpenedCallback);
   scanResultPage.setClosedCallback(deleteAllPageItems);
   scanResultPage.setRenderedCallback(pageRenderedCallback);
@@ -383,26 +550,34 @@ void uiMenuInit(void)
 
   MinuPage pingTargetsPage("PING TARGETS", menu.numPages());
   for (PingTarget target : pingTargets)
+  {
     pingTargetsPage.addItem(NULL, target.displayHostname.c_str(), " ");
+    pingProbes.addTarget((target.useIP) ? target.pingIP.toString().c_str() : target.fqn.c_str(), PING_INTERVAL_MS, PING_TIMEOUT_MS);
+  }
+  pingProbes.setCallback(publishPingResult);
   pingTargetsPage.addItem(goToHomePage, "<--", NULL);
   pingTargetsPage.setOpenedCallback(startDataUpdate);
   pingTargetsPage.setClosedCallback(stopDataUpdate);
   pingTargetsPage.setRenderedCallback(pageRenderedCallback);
   pingTargetsPageId = menu.addPage(pingTargetsPage);
 
+  // Info pages write to the menu canvas as soon as they are opened, so that their first render is complete
   MinuPage timePage("TIME", menu.numPages(), true);
   timePage.addItem(goToHomePage, NULL, NULL);
-  timePage.setOpenedCallback(pageOpenedCallback);
-  timePage.setClosedCallback(stopDataUpdate);
-  timePage.setRenderedCallback(startDataUpdate);
+  timePage.setOpenedCallback(startDataUpdate);
+  timePage.setRenderedCallback(pageRenderedCallback);
   timePageId = menu.addPage(timePage);
 
-  MinuPage fobInfoPage("FOB INFO", menu.numPages(), true);
-  fobInfoPage.addItem(goToHomePage, NULL, NULL);
-  fobInfoPage.setOpenedCallback(pageOpenedCallback);
-  fobInfoPage.setClosedCallback(stopDataUpdate);
-  fobInfoPage.setRenderedCallback(startDataUpdate);
-  fobInfoPageId = menu.addPage(fobInfoPage);
+  // The fob info page is rarely visited, so it is only built when opened and freed a while after it is closed
+  fobInfoPageId = menu.addLazyPage("FOB INFO", buildFobInfoPage, true);
+
+  // The timezone page lists all ~600 timezones, but only decodes those on screen
+  MinuPage timezonePage("TIMEZONE", menu.numPages());
+  timezoneSource.setCallbacks(selectTimezone);
+  timezonePage.setItemSource(&timezoneSource);
+  timezonePage.setClosedCallback(pageClosedCallback);
+  timezonePage.setRenderedCallback(pageRenderedCallback);
+  timezonePageId = menu.addPage(timezonePage);
 
   String cookie;
    if ( homePageId < 0 ||
@@ -413,10 +588,35 @@ void uiMenuInit(void)
       goto err;
       
 
-  xTaskCreatePinnedToCore(screenWatchTask, "Screen Watch Task", 4096, NULL, 1, &screenWatchTaskHandle, ARDUINO_RUNNING_CORE);
-  xTaskCreatePinnedToCore(screenUpdateTask, "Screen Update Task", 4096, NULL, 1, &screenUpdateTaskHandle, ARDUINO_RUNNING_CORE);
-  xTaskCreatePinnedToCore(buttonWatchTask, "Button Task", 4096, NULL, 1, &buttonWatchTaskHandle, ARDUINO_RUNNING_CORE);
+  // The canvas holds the content of the info pages, below their title
+  menu.canvas().resize(MINU_MAIN_TEXT_LEN + MINU_AUX_TEXT_LEN + 1, MINU_ITEM_MAX_COUNT);
+  timeService.bindCanvas(menu.canvas(), 0, 0, MINU_TIME_FIELD_TIME);
+  timeService.bindCanvas(menu.canvas(), 0, 1, MINU_TIME_FIELD_DATE);
+
+  // The RTC is written from the UI loop rather than from the SNTP notification, which only requests it
+  timeService.setSyncCallback(syncRtcToSystemTime, NULL, RTC_SYNC_INTERVAL_S);
+  uiLoop.addPeriodic(10000, pollTimeSync, NULL, 1000);
+
+  // Navigation callbacks query the Wi-Fi state and start page updates, so they are kept off the navigation path
+  uiLoop.setDeferredCallbacks(&uiCallbacks);
+
+  // Scrolling through a page only calls the highlighted callback of the item it stops on
+  uiLoop.setHighlightSettleTime(200);
+
+  uiLoop.setPageReleaseDelay(30000);
+
+  // Printing a full page to the LCD takes longer than a button press should wait, so frames are printed in slices
+  uiLoop.setRenderBudget(UI_RENDER_BUDGET_MS);
+
+#ifdef UI_DEBUG_LOG
+  uiLoop.addPeriodic(10000, logMemoryUsage, NULL, 1000);
+#endif
+
+  // Open the homepage before the UI loop starts so that it is rendered as soon as the loop runs
   goToHomePage();
+  uiLoop.setPreRenderCallback(clearScreen);
+  xTaskCreatePinnedToCore(uiLoopTask, "UI Loop Task", 4096, NULL, 1, &uiLoopTaskHandle, ARDUINO_RUNNING_CORE);
+  xTaskCreatePinnedToCore(buttonWatchTask, "Button Task", 4096, NULL, 1, &buttonWatchTaskHandle, ARDUINO_RUNNING_CORE);
   return;
 
 err:
@@ -427,96 +627,31 @@ err:
   }
 }
 
-/// @brief Watch for any detected button press and manipulate UI accordingly
-void screenWatchTask(void *arg)
+/// @brief Runs the UI event loop, which handles button presses and renders the menu
+void uiLoopTask(void *arg)
 {
-  Serial.println("Started screenWatchTask");
-  ssize_t lastSelectedPage = menu.currentPageId();
-  ssize_t lastHighlightedItem = menu.currentPage()->highlightedIndex();
-
-  bool updateScreen = false;
-  long lastStackCheckTime = 0;
-
-  for (;;)
-  {
-    // If a short press of A is detected, highlight the next item
-    if (shortPressA)
-    {
-#ifdef UI_BEEP
-      M5.Speaker.tone(8000, 30);
-#endif
- 
-      menu.currentPage()->highlightNextItem();
-      if(lastHighlightedItem != menu.currentPage()->highlightedIndex())
-        updateScreen = true;
-
-      shortPressA = false;
-    }
-
-    // If a long press of A or short press of B is detected, select the currently highlighted item
-    if (longPressA || shortPressB)
-    {
-#ifdef UI_BEEP
-      M5.Speaker.tone(5000, 30);
-#endif
-      if (menu.currentPage()->highlightedIndex() >= 0)
-      {
-        MinuPageItem highlightedItem = menu.currentPage()->highlightedItem();
-        if (highlightedItem.link())
-          highlightedItem.link()(&highlightedItem);
-#ifdef UI_DEBUG_LOG
-        Serial.printf("Executed selected item link = %p\n", highlightedItem.link());
-#endif
-      }
-
-      longPressA = false;
-      shortPressB = false;
-    }
-
-    // If a long press of B is detected, cancel any ongoing shutdown
-    if (longPressB)
-    {
-      longPressB = false;
-    }
-
-    // If the current page has changed, log the change
-    if (lastSelectedPage != menu.currentPageId())
-    {
-#ifdef UI_DEBUG_LOG
-      Serial.printf("Changed from page %d to page %d\n", lastSelectedPage, menu.currentPageId());
-#endif
-      lastSelectedPage = menu.currentPageId();
-      lastHighlightedItem = menu.currentPage()->highlightedIndex();
-    }
-
-    // If the current page has changed, log the change
-    if (lastHighlightedItem != menu.currentPage()->highlightedIndex())
-    {
-#ifdef UI_DEBUG_LOG
-      Serial.printf("Highlighted item changed: Old = %d | New = %d\n", lastHighlightedItem, menu.currentPage()->highlightedIndex());
-#endif
-      lastHighlightedItem = menu.currentPage()->highlightedIndex();
-    }
-
-    if (updateScreen || !menu.rendered())
-    {
-      updateScreen = false;
-
-      if (screenUpdateTaskHandle)
-        xTaskNotify(screenUpdateTaskHandle, 1, eSetValueWithOverwrite);
-      while(!menu.rendered())
-        delay(10);
-    }
+  Serial.println("Started uiLoopTask");
+  uiLoop.run();
+  uiLoopTaskHandle = NULL;
+  vTaskDelete(NULL);
+}
 
 #ifdef UI_DEBUG_LOG
-    if (lastStackCheckTime + 10000 < millis())
-    {
-      Serial.printf("Screen Watch Task available stack:  %d * %d bytes\n", uxTaskGetStackHighWaterMark(NULL), sizeof(portBASE_TYPE));
-      lastStackCheckTime = millis();
-    }
+/// @brief Prints the RAM used by the menu and the stack left to the UI loop task
+void logMemoryUsage(void *arg)
+{
+  MinuMemoryUsage usage = menu.memoryUsage();
+  Serial.printf("Menu memory: %u bytes (pages %u, items %u, text %u, caches %u, scratch %u)\n", usage.total(),
+                usage.pages, usage.items, usage.text, usage.caches, usage.scratch);
+  for (size_t i = 0; i < menu.numPages(); ++i)
+    Serial.printf("  page %u \"%s\": %u bytes\n", i, menu.pages()[i]->title(), menu.pages()[i]->memoryUsage().total());
+#ifdef MINU_LOOP_STACK_PROBE
+  Serial.printf("UI loop stack used: render %u, callbacks %u bytes\n", uiLoop.renderStack().maxDepth(),
+                uiLoop.callbackStack().maxDepth());
 #endif
-  }
+  Serial.printf("UI Loop Task available stack:  %d * %d bytes\n", uxTaskGetStackHighWaterMark(NULL), sizeof(portBASE_TYPE));
 }
+#endif
 
 void buttonWatchTask(void *arg)
 {
@@ -533,16 +668,17 @@ void buttonWatchTask(void *arg)
 
     if (M5.BtnA.wasReleased())
     {
+      // A long press of A selects the highlighted item, a short press highlights the next item
       if (lastButtonADownTime + LONG_PRESS_THRESHOLD_MS < currentTime)
       {
-        longPressA = true;
+        uiPostInput(MINU_INPUT_SELECT);
 #ifdef UI_DEBUG_LOG
         Serial.print("Long");
 #endif
       }
       else
       {
-        shortPressA = true;
+        uiPostInput(MINU_INPUT_NEXT);
 #ifdef UI_DEBUG_LOG
         Serial.print("Short");
 #endif
@@ -555,18 +691,27 @@ void buttonWatchTask(void *arg)
     if (M5.BtnB.wasPressed())
       lastButtonBDownTime = currentTime;
 
+    // Holding B scrolls through the page, faster the longer it is held
+    if (!buttonBHeld && M5.BtnB.pressedFor(LONG_PRESS_THRESHOLD_MS))
+    {
+      buttonBHeld = true;
+      uiPostInput(MINU_INPUT_NEXT | MINU_INPUT_HELD);
+    }
+
     if (M5.BtnB.wasReleased())
     {
-      if (lastButtonBDownTime + LONG_PRESS_THRESHOLD_MS < currentTime)
+      // A short press of B selects the highlighted item, a long press scrolls
+      if (buttonBHeld)
       {
-        longPressB = true;
+        buttonBHeld = false;
+        uiPostInput(MINU_INPUT_RELEASE);
 #ifdef UI_DEBUG_LOG
         Serial.print("Long");
 #endif
       }
       else
       {
-        shortPressB = true;
+        uiPostInput(MINU_INPUT_SELECT);
 #ifdef UI_DEBUG_LOG
         Serial.print("Short");
 #endif
@@ -582,58 +727,18 @@ void buttonWatchTask(void *arg)
       lastStackCheckTime = currentTime;
     }
 #endif
+    // The buttons have to be polled, but there is no need to do so more often than a human can press them
+    vTaskDelay(pdMS_TO_TICKS(BUTTON_POLL_INTERVAL_MS));
   }
 }
 
-void dataUpdateTask(void *arg)
+/// @brief Pings the ping targets while their page is open, and sleeps otherwise
+void probeTask(void *arg)
 {
-  while (!menu.rendered())
-    delay(10);
-  
-  const int cursorX = M5.Lcd.getCursorX();
-  const int cursorY = M5.Lcd.getCursorY();
-
-  int updateType = (int)arg;
-#ifdef UI_DEBUG_LOG
-  Serial.printf("Started data update task: type %d\n", updateType);
-#endif
-  M5.Lcd.fillRect(0, cursorY, M5.Lcd.width(), M5.Lcd.height() - cursorY, MINU_BACKGROUND_COLOUR_DEFAULT);
-
   while (1)
   {
-    M5.Lcd.setCursor(cursorX, cursorY);
-    Serial.printf("Update type %d started\n", updateType);
-
-    if (updateType == UI_UPDATE_TYPE_TIME)
-      lcdPrintTime();
-    else if (updateType == UI_UPDATE_TYPE_FOB_INFO)
-      lcdPrintFobInfo();
-    else if (updateType == UI_UPDATE_TYPE_PING)
-      updatePingTargetsStatus();
-
-    Serial.printf("Update type %d done\n", updateType);
-    vTaskDelay(pdMS_TO_TICKS(1000));
-
-}
-
-  dataUpdateTaskHandle = NULL;
-  vTaskDelete(NULL);
-}
-
-/// @brief Performs the actual rendering of the screen upon receiving a task notification
-void screenUpdateTask(void *arg)
-{
-  uint32_t renderMenu;
-  while (1)
-  {
-    renderMenu = ulTaskNotifyTake(false, portMAX_DELAY);
-    if (renderMenu == 1)
-    {
-      M5.Lcd.clear();
-      M5.Lcd.setCursor(0, 0);
-      M5.Lcd.setTextSize(TEXT_SIZE_DEFAULT);
-      menu.render(MINU_ITEM_MAX_COUNT);
-    }
+    pingProbes.run();
+    // Until the ping targets page is opened again
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
   }
-  vTaskDelete(NULL);
-}
\ No newline at end of file
+}
@@ -2,14 +2,12 @@
 #define _MINU_M5CP2_UI_H_
 
 #include "../../minu.hpp"
+#include "../../minu_loop.hpp"
+#include "../../minu_time.hpp"
 #include "config.h"
 
 /// Variables used to keep track of button states
 extern long currentTime;
-extern bool longPressA;
-extern bool longPressB;
-extern bool shortPressA;
-extern bool shortPressB;
 
 /// Menu and menu pages
 extern Minu menu;
@@ -20,13 +18,18 @@ extern size_t pingTargetsPageId;
 extern size_t timePageId;
 extern size_t fobInfoPageId;
 
+/// @brief Event loop that handles button presses and renders the menu
+extern MinuEventLoop<> uiLoop;
+
+/// @brief Date and time shown on the time page, and the schedule on which the RTC is synced to network time
+extern MinuTimeService<> timeService;
+
 /// @brief Initialize the menu system and set up child pages and items
 void uiMenuInit(void);
 
 /// Task handles for UI threads
-extern TaskHandle_t screenWatchTaskHandle;
-extern TaskHandle_t screenUpdateTaskHandle;
+extern TaskHandle_t uiLoopTaskHandle;
 extern TaskHandle_t buttonWatchTaskHandle;
-extern TaskHandle_t dataUpdateTaskHandle;
+extern TaskHandle_t probeTaskHandle;
 
 #endif
\ No newline at end of file
@@ -4,28 +4,16 @@
  */
 
 #include "M5StickCPlus2.h"
+#include <sys/time.h>
 #include "config.h"
 #include "utils.h"
 
-void setTimezone(const char* tzone)
+void syncRtcToSystemTime(void *arg)
 {
-  Serial.printf("Setting Timezone to %s\n",tzone);
-  setenv("TZ",tzone,1);
-  tzset();
-}
-
-bool syncNtpToRtc(const char* tzone)
-{
-  struct tm timeinfo;
-  if (!getLocalTime(&timeinfo))
-  {
-    Serial.println("Failed to obtain NTP time");
-    return false;
-  }
-  setTimezone(tzone);
-  time_t syncT = time(nullptr) + 1;   // Advance one second
-  while (syncT > time(nullptr));      // and wait for the actual time to catch up
-  M5.Rtc.setDateTime(gmtime(&syncT)); // Set the new date and time to RTC
-  Serial.println(&timeinfo, "Local time: %I:%M:%S%p %A, %B-%d-%Y ");
-  return true;
+  // The RTC only counts whole seconds, so the system time is rounded rather than waited on until the second turns
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  time_t seconds = now.tv_sec + (now.tv_usec >= 500000);
+  M5.Rtc.setDateTime(gmtime(&seconds));
+  Serial.printf("RTC synced to network time: %ld\n", (long)seconds);
 }
@@ -25,10 +25,8 @@ struct PingTarget {
 /// @brief List of targets to be pinged
 extern std::vector<PingTarget> pingTargets;
 
-/// @brief Modify the timezone of network-synced time
-void setTimezone(const char* tzone);
-
-/// @brief Synchronize local RTC time to network time while setting the default timezone
-bool syncNtpToRtc(const char* tzone);
+/// @brief Set the RTC to the system time, which SNTP keeps in sync with network time
+/// @note  Run by the time service, on the UI loop, once the SNTP notification has requested it
+void syncRtcToSystemTime(void *arg = NULL);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,121 @@
+/*
+ * @file  action_check.cpp
+ * @brief Checks which page the actions of minu_action.hpp are bound to, and that leaving a page cancels them.
+ *
+ * Sleeps are also checked to last their full length when an action only starts sleeping after other work.
+ *
+ * A runner is driven by hand, with the current page kept in a variable that the checks change between polls, as
+ * input handled by the event loop would. Each check prints one "key value" pair, 1 if it passed, and the exit
+ * status is non-zero if any failed.
+ *
+ * Build and run on a host, e.g.:
+ *   g++ -std=c++20 -O2 -I../.. action_check.cpp -o action_check && ./action_check
+ */
+
+#include <stdio.h>
+
+#include "minu_action.hpp"
+
+#ifndef MINU_HAS_ACTIONS
+#error "Actions need a compiler with coroutine support, e.g. GCC 10+ with -std=c++20"
+#endif
+
+static ssize_t currentPage = 1;
+static int wakes = 0;
+
+static ssize_t pageId(void *arg) { return currentPage; }
+
+static uint32_t clockMs = 0;
+
+static uint32_t currentTime(void *arg) { return clockMs; }
+
+/// @brief Rescans forever, as the example's Wi-Fi scan does
+static MinuAction rescan(void)
+{
+  while (true)
+  {
+    wakes++;
+    co_await MinuSleep(100);
+  }
+}
+
+/// @brief Opens another page to show its results
+static MinuAction showResults(void)
+{
+  co_await MinuSleep(100);
+  currentPage = 3;
+  co_await MinuSleep(100);
+  wakes++;
+}
+
+/// @brief Works for a while, as a slow step would, before sleeping
+static MinuAction workThenSleep(void)
+{
+  clockMs += 300;
+  co_await MinuSleep(100);
+  wakes++;
+}
+
+static int failures = 0;
+
+static void check(const char *name, bool passed)
+{
+  printf("%s %d\n", name, passed ? 1 : 0);
+  failures += passed ? 0 : 1;
+}
+
+int main()
+{
+  MinuActionRunner runner;
+  runner.setPageIdFunction(pageId);
+
+  // The user leaves the page while the action sleeps, and the loop handles the input before polling
+  currentPage = 1;
+  runner.start(rescan(), 0, currentPage);
+  runner.poll(0, currentPage);
+  runner.poll(100, currentPage);
+  currentPage = 2;
+  runner.poll(150, currentPage);
+  check("cancelled_after_leaving_page", runner.active() == 0);
+
+  // Without a page id function, the page passed to poll() is used
+  MinuActionRunner plain;
+  currentPage = 1;
+  plain.start(rescan(), 0, currentPage);
+  plain.poll(100, currentPage);
+  currentPage = 2;
+  plain.poll(150, currentPage);
+  check("cancelled_without_page_function", plain.active() == 0);
+
+  // An action that opens another page itself belongs to that page
+  wakes = 0;
+  currentPage = 1;
+  runner.start(showResults(), 0, currentPage);
+  runner.poll(100, currentPage);
+  check("follows_page_it_opened", runner.active() == 1);
+  runner.poll(200, currentPage);
+  check("finished_on_page_it_opened", runner.active() == 0 && wakes == 1);
+
+  // Repeated visits do not pile up actions
+  for (int visit = 0; visit < 3 * MINU_ACTION_MAX; ++visit)
+  {
+    currentPage = 1;
+    runner.start(rescan(), visit * 1000, currentPage);
+    runner.poll(visit * 1000 + 100, currentPage);
+    currentPage = 2;
+    runner.poll(visit * 1000 + 150, currentPage);
+  }
+  check("no_actions_left_after_visits", runner.active() == 0);
+
+  // A sleep is measured from when it starts, not from the poll that resumed the action
+  MinuActionRunner timed;
+  timed.setTimeFunction(currentTime);
+  wakes = 0;
+  clockMs = 1000;
+  timed.start(workThenSleep(), clockMs, 1);
+  timed.poll(1350, 1);
+  check("sleep_not_cut_short", wakes == 0 && timed.timeout(1350) == 50);
+  timed.poll(1400, 1);
+  check("sleep_ends_on_time", wakes == 1 && timed.active() == 0);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,161 @@
+/*
+ * @file  blit_bench.cpp
+ * @brief Micro-benchmark comparing the RGB565 glyph expansion and fill kernels in minu_blit.hpp.
+ *
+ * Before anything is timed, every kernel's output is compared with a naive loop for random lengths, colours and
+ * source bits, with the destination and source at random offsets from their alignment. Any pixel that differs, or
+ * any write outside the destination, is reported and the benchmark exits with a non-zero status.
+ *
+ * Build and run on a host, e.g.:
+ *   g++ -O2 -march=native -I../.. blit_bench.cpp -o blit_bench && ./blit_bench
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+
+#include "minu_blit.hpp"
+
+typedef void (*ExpandKernel)(uint16_t *, const uint8_t *, size_t, uint16_t, uint16_t);
+typedef void (*FillKernel)(uint16_t *, size_t, uint16_t);
+
+#define BENCH_WIDTH   480   // Pixels per row, e.g. a 480x320 panel
+#define BENCH_HEIGHT  320
+#define BENCH_FRAMES  2000
+#define VERIFY_RUNS   20000  // Random cases compared with the naive loop per kernel
+#define VERIFY_MAX    300    // Longest run of pixels verified
+#define VERIFY_GUARD  32     // Pixels on either side of the destination that must be left untouched
+
+static volatile uint16_t sink;
+
+/// @brief Returns the throughput of an expansion kernel in megapixels per second
+static double benchExpand(ExpandKernel kernel)
+{
+  std::vector<uint16_t> pixels(BENCH_WIDTH * BENCH_HEIGHT);
+  std::vector<uint8_t> bits(BENCH_WIDTH / 8 * BENCH_HEIGHT);
+  for (size_t i = 0; i < bits.size(); ++i)
+    bits[i] = rand();
+
+  auto start = std::chrono::steady_clock::now();
+  for (int f = 0; f < BENCH_FRAMES; ++f)
+    for (int y = 0; y < BENCH_HEIGHT; ++y)
+      kernel(&pixels[y * BENCH_WIDTH], &bits[y * BENCH_WIDTH / 8], BENCH_WIDTH, 0xFFFF, (uint16_t)f);
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  sink = pixels[rand() % pixels.size()];
+  return (double)BENCH_WIDTH * BENCH_HEIGHT * BENCH_FRAMES / seconds / 1e6;
+}
+
+/// @brief Returns the throughput of a fill kernel in megapixels per second
+static double benchFill(FillKernel kernel)
+{
+  std::vector<uint16_t> pixels(BENCH_WIDTH * BENCH_HEIGHT);
+
+  auto start = std::chrono::steady_clock::now();
+  for (int f = 0; f < BENCH_FRAMES; ++f)
+    for (int y = 0; y < BENCH_HEIGHT; ++y)
+      kernel(&pixels[y * BENCH_WIDTH], BENCH_WIDTH, (uint16_t)f);
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  sink = pixels[rand() % pixels.size()];
+  return (double)BENCH_WIDTH * BENCH_HEIGHT * BENCH_FRAMES / seconds / 1e6;
+}
+
+/// @brief Reference implementation writing one pixel at a time, as a naive renderer would
+static void expandNaive(uint16_t *dst, const uint8_t *bits, size_t count, uint16_t fore, uint16_t back)
+{
+  for (size_t i = 0; i < count; ++i)
+    dst[i] = (bits[i >> 3] & (0x80 >> (i & 7))) ? fore : back;
+}
+
+static void fillNaive(uint16_t *dst, size_t count, uint16_t colour)
+{
+  for (size_t i = 0; i < count; ++i)
+    dst[i] = colour;
+}
+
+/// @brief  Compare an expansion kernel with expandNaive() on random cases
+/// @return false, if any output differed
+static bool verifyExpand(const char *name, ExpandKernel kernel)
+{
+  std::vector<uint16_t> expected(VERIFY_MAX + 2 * VERIFY_GUARD), actual(expected.size());
+  std::vector<uint8_t> bits(VERIFY_MAX / 8 + 2 + VERIFY_GUARD);
+
+  for (int run = 0; run < VERIFY_RUNS; ++run)
+  {
+    size_t count = rand() % (VERIFY_MAX + 1);
+    size_t offset = VERIFY_GUARD - rand() % 16;  // Destination misaligned by 0 to 15 pixels
+    size_t bitsOffset = rand() % VERIFY_GUARD;
+    uint16_t fore = rand(), back = rand(), guard = rand();
+    for (size_t i = 0; i < bits.size(); ++i)
+      bits[i] = rand();
+
+    expected.assign(expected.size(), guard);
+    actual.assign(actual.size(), guard);
+    expandNaive(&expected[offset], &bits[bitsOffset], count, fore, back);
+    kernel(&actual[offset], &bits[bitsOffset], count, fore, back);
+    if (expected != actual)
+    {
+      fprintf(stderr, "%s expand differs: count %zu, dst offset %zu, bits offset %zu\n", name, count, offset,
+              bitsOffset);
+      return false;
+    }
+  }
+  return true;
+}
+
+/// @brief  Compare a fill kernel with fillNaive() on random cases
+/// @return false, if any output differed
+static bool verifyFill(const char *name, FillKernel kernel)
+{
+  std::vector<uint16_t> expected(VERIFY_MAX + 2 * VERIFY_GUARD), actual(expected.size());
+
+  for (int run = 0; run < VERIFY_RUNS; ++run)
+  {
+    size_t count = rand() % (VERIFY_MAX + 1);
+    size_t offset = VERIFY_GUARD - rand() % 16;
+    uint16_t colour = rand(), guard = rand();
+
+    expected.assign(expected.size(), guard);
+    actual.assign(actual.size(), guard);
+    fillNaive(&expected[offset], count, colour);
+    kernel(&actual[offset], count, colour);
+    if (expected != actual)
+    {
+      fprintf(stderr, "%s fill differs: count %zu, dst offset %zu\n", name, count, offset);
+      return false;
+    }
+  }
+  return true;
+}
+
+int main()
+{
+  bool verified = verifyExpand("scalar", minuExpandBitsScalar) && verifyFill("scalar", minuFill565Scalar);
+#ifdef MINU_BLIT_SSE2
+  verified = verified && verifyExpand("sse2", minuExpandBitsSse2) && verifyFill("sse2", minuFill565Sse2);
+#endif
+#ifdef MINU_BLIT_AVX2
+  verified = verified && verifyExpand("avx2", minuExpandBitsAvx2) && verifyFill("avx2", minuFill565Avx2);
+#endif
+#ifdef MINU_BLIT_NEON
+  verified = verified && verifyExpand("neon", minuExpandBitsNeon) && verifyFill("neon", minuFill565Neon);
+#endif
+  if (!verified)
+    return 1;
+
+  printf("%-8s %14s %14s\n", "kernel", "expand Mpx/s", "fill Mpx/s");
+  printf("%-8s %14.1f %14.1f\n", "naive", benchExpand(expandNaive), benchFill(fillNaive));
+  printf("%-8s %14.1f %14.1f\n", "scalar", benchExpand(minuExpandBitsScalar), benchFill(minuFill565Scalar));
+#ifdef MINU_BLIT_SSE2
+  printf("%-8s %14.1f %14.1f\n", "sse2", benchExpand(minuExpandBitsSse2), benchFill(minuFill565Sse2));
+#endif
+#ifdef MINU_BLIT_AVX2
+  printf("%-8s %14.1f %14.1f\n", "avx2", benchExpand(minuExpandBitsAvx2), benchFill(minuFill565Avx2));
+#endif
+#ifdef MINU_BLIT_NEON
+  printf("%-8s %14.1f %14.1f\n", "neon", benchExpand(minuExpandBitsNeon), benchFill(minuFill565Neon));
+#endif
+  return 0;
+}
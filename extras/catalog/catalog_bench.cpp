@@ -0,0 +1,144 @@
+/*
+ * @file  catalog_bench.cpp
+ * @brief Measures the latency of scrolling through a large file-backed catalog (minu_catalog.hpp).
+ *
+ * A catalog of N items is written to a file, then browsed by a page rendering through a backend that only counts
+ * what it is given: first scrolling forwards one item at a time, then backwards, then jumping to random items. This
+ * is done once reading the file with stdio and once with mmap, and the render time of each step is reported.
+ *
+ * Build and run on a host, e.g.:
+ *   g++ -O2 -I../.. catalog_bench.cpp -o catalog_bench && ./catalog_bench [items] [path]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "minu_catalog.hpp"
+
+#define BENCH_ITEMS_DEFAULT  100000
+#define BENCH_RENDER_COUNT   8     // Rows shown at once
+#define BENCH_SCROLL_STEPS   5000
+#define BENCH_JUMPS          1000
+
+/// @brief Backend that only counts what it is given
+struct CountingBackend
+{
+  void print(const char *msg, uint16_t len, uint16_t fore, uint16_t back) { this->bytes += len; }
+  void printInverted(const char *msg, uint16_t len, uint16_t fore, uint16_t back) { this->bytes += len; }
+  void begin(bool partial) {}
+  bool moveTo(uint16_t col, uint16_t row) { return true; }
+  void flush(void) {}
+
+  size_t bytes = 0;
+};
+
+static double percentile(std::vector<double> values, double p)
+{
+  if (values.empty())
+    return 0;
+  std::sort(values.begin(), values.end());
+  return values[(size_t)(p * (values.size() - 1))];
+}
+
+static void report(const char *name, const std::vector<double> &times)
+{
+  printf("%s_us_p50 %.2f\n", name, percentile(times, 0.5));
+  printf("%s_us_p95 %.2f\n", name, percentile(times, 0.95));
+  printf("%s_us_max %.2f\n", name, percentile(times, 1.0));
+}
+
+/// @brief Browse the catalog with the given reader and print the render times of each phase
+template <class Reader>
+static bool bench(const char *name, const char *path, size_t items)
+{
+  MinuCatalog<Reader> catalog;
+  if (!catalog.open(path) || catalog.itemCount() != items)
+  {
+    fprintf(stderr, "%s: could not open %s\n", name, path);
+    return false;
+  }
+
+  MinuBasic<CountingBackend> menu(CountingBackend(), 16, 6);
+  MinuPage page("CATALOG", 0);
+  menu.addPage(page);
+  menu.currentPage()->setItemSource(&catalog);
+  menu.goToPage(0);
+
+  std::vector<double> forward, backward, jumps;
+  auto step = [&](std::vector<double> &times) {
+    auto start = std::chrono::steady_clock::now();
+    menu.render(BENCH_RENDER_COUNT);
+    times.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+  };
+
+  for (size_t i = 0; i < BENCH_SCROLL_STEPS; ++i)
+  {
+    menu.currentPage()->moveHighlight(1, false);
+    step(forward);
+  }
+  for (size_t i = 0; i < BENCH_SCROLL_STEPS; ++i)
+  {
+    menu.currentPage()->moveHighlight(-1, false);
+    step(backward);
+  }
+  srand(1);
+  for (size_t i = 0; i < BENCH_JUMPS; ++i)
+  {
+    menu.currentPage()->highlightItem(((size_t)rand() * RAND_MAX + rand()) % items);
+    step(jumps);
+  }
+
+  printf("reader %s\n", name);
+  report("forward", forward);
+  report("backward", backward);
+  report("jump", jumps);
+  const MinuCatalogStats &stats = catalog.stats();
+  printf("cache_hits %u\n", stats.hits);
+  printf("cache_misses %u\n", stats.misses);
+  printf("prefetches %u\n", stats.prefetches);
+  printf("reads %u\n", stats.reads);
+  printf("bytes_read %u\n", stats.bytesRead);
+  printf("cache_bytes %zu\n", catalog.memoryUsage().total());
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  size_t items = (argc > 1) ? strtoul(argv[1], NULL, 10) : BENCH_ITEMS_DEFAULT;
+  const char *path = (argc > 2) ? argv[2] : "catalog_bench.cat";
+  if (!items)
+  {
+    fprintf(stderr, "Usage: %s [items] [path]\n", argv[0]);
+    return 2;
+  }
+
+  MinuCatalogWriter writer;
+  if (!writer.begin(path))
+  {
+    perror(path);
+    return 2;
+  }
+  for (size_t i = 0; i < items; ++i)
+  {
+    char mainText[32], auxText[8];
+    snprintf(mainText, sizeof(mainText), "Entry %zu", i);
+    snprintf(auxText, sizeof(auxText), "%zu", i % 100);
+    writer.add(mainText, auxText, MINU_FOREGROUND_COLOUR_DEFAULT, (uint16_t)i);
+  }
+  if (!writer.finish())
+  {
+    perror(path);
+    return 2;
+  }
+
+  printf("items %zu\n", items);
+  bool ok = bench<MinuFileReader>("stdio", path, items);
+#ifdef __linux__
+  ok = bench<MinuMmapReader>("mmap", path, items) && ok;
+#endif
+  remove(path);
+  return (ok) ? 0 : 1;
+}
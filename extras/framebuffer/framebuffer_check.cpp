@@ -0,0 +1,162 @@
+/*
+ * @file  framebuffer_check.cpp
+ * @brief Checks the pixels drawn by minu_framebuffer.hpp against golden images.
+ *
+ * A fixed set of pages is rendered into a MinuMemoryPanel: a list whose highlight moves and whose statuses change
+ * between frames, so that only some cells are redrawn, and an info page drawn from the canvas. Each step is rendered
+ * with the whole framebuffer and the default merge gap, without merging, and tiled, at scale 1 and 2, and the panel
+ * must match the same PPM image in the golden directory in every mode. A full redraw must also leave the panel as
+ * the partial frames left it. Each check prints one "key value" pair, 1 if it passed, and the exit status is
+ * non-zero if any failed.
+ *
+ * The images are resolved RGB565, so the check passes in builds with and without MINU_PALETTE. After a deliberate
+ * change to the font or the layout, regenerate them with --update and check the new images before committing them.
+ *
+ * Build and run on a host, e.g.:
+ *   g++ -O2 -I../.. framebuffer_check.cpp -o framebuffer_check && ./framebuffer_check [--update] [golden_dir]
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "minu_framebuffer.hpp"
+
+#ifdef MINU_PALETTE
+#define CHECK_RED    MINU_PALETTE_RED
+#define CHECK_GREEN  MINU_PALETTE_GREEN
+#define CHECK_YELLOW MINU_PALETTE_YELLOW
+#else
+#define CHECK_RED    0xF800
+#define CHECK_GREEN  0x07E0
+#define CHECK_YELLOW 0xFFE0
+#endif
+
+typedef MinuPixelRenderer<MinuMemoryPanel> Renderer;
+
+/// @brief One way of configuring the renderer. Every mode must draw the same pixels
+struct CheckMode
+{
+  const char *name;
+  bool tiled;
+  uint8_t mergeGap;
+};
+
+static const CheckMode modes[] = {
+    {"merged", false, MINU_PIXEL_MERGE_GAP_DEFAULT},
+    {"unmerged", false, 0},
+    {"tiled", true, MINU_PIXEL_MERGE_GAP_DEFAULT},
+};
+
+static const char *goldenDir = "golden";
+static bool update = false;
+static int failures = 0;
+
+static void check(const char *name, bool passed)
+{
+  printf("%s %d\n", name, passed ? 1 : 0);
+  failures += passed ? 0 : 1;
+}
+
+/// @brief Compare the panel with a golden image, or replace the image with --update
+static void checkImage(const char *name, const char *image, const MinuMemoryPanel &panel)
+{
+  char path[256];
+  snprintf(path, sizeof(path), "%s/%s.ppm", goldenDir, image);
+
+  if (update)
+  {
+    check(name, panel.writePpm(path));
+    return;
+  }
+
+  ssize_t mismatches = panel.comparePpm(path);
+  if (mismatches)
+    fprintf(stderr, "%s: %zd pixels differ from %s\n", name, mismatches, path);
+  check(name, mismatches == 0);
+}
+
+/// @brief Render the pages step by step in one mode, checking the panel after each step
+/// @param scale    Integer factor by which the font is enlarged
+/// @param mainLen  Length of the main text, which with \a auxLen sets the number of columns
+static void run(const CheckMode &mode, uint8_t scale, uint16_t mainLen, uint16_t auxLen)
+{
+  const uint16_t cols = mainLen + auxLen + 1, rows = 6;
+  MinuMemoryPanel blank(cols * MINU_FONT_6X8.width * scale, rows * MINU_FONT_6X8.height * scale);
+  MinuBasic<Renderer> menu(Renderer(blank, cols, rows, scale, mode.tiled), mainLen, auxLen);
+  Renderer &renderer = menu.backend();
+  const MinuMemoryPanel &panel = renderer.panel();
+  renderer.setMergeGap(mode.mergeGap);
+
+  menu.addPage("STATUS");
+  MinuPage *list = menu.pages()[0];
+  list->addItem(NULL, "Wi-Fi", "OK");
+  list->addItem(NULL, "Ping targets", "3");
+  list->addItem(NULL, "Gateway", "1ms");
+  list->addItem(NULL, "DNS", "ERR");
+  list->addItem(NULL, "Time", "NTP");
+  list->addItem(NULL, "Fob Info", NULL);
+  list->items()[0].setStatus(1, CHECK_GREEN, MINU_BACKGROUND_COLOUR_DEFAULT);
+  list->items()[3].setStatus(2, CHECK_RED, MINU_BACKGROUND_COLOUR_DEFAULT);
+
+  menu.addPage(MinuPage("INFO", 1, true));
+  menu.canvas().resize(cols, rows - 1);
+
+  char name[64], image[64];
+  const char *prefix = (scale > 1) ? "scaled_" : "";
+
+  // The first frame draws every cell
+  menu.goToPage(0);
+  menu.render(rows - 1);
+  snprintf(name, sizeof(name), "%slist_%s", prefix, mode.name);
+  snprintf(image, sizeof(image), "%slist", prefix);
+  checkImage(name, image, panel);
+
+  // Moving the highlight redraws two rows, and changing statuses redraws runs of cells on rows between them
+  list->highlightNextItem();
+  list->highlightNextItem();
+  list->items()[2].setAuxText("12ms");
+  list->items()[3].setStatus(1, CHECK_GREEN, MINU_BACKGROUND_COLOUR_DEFAULT);
+  list->items()[3].setAuxText("OK");
+  menu.render(rows - 1);
+  snprintf(name, sizeof(name), "%slist_update_%s", prefix, mode.name);
+  snprintf(image, sizeof(image), "%slist_update", prefix);
+  checkImage(name, image, panel);
+
+  // An info page replaces every row, with text in several colours and cells left blank
+  menu.goToPage(1);
+  menu.canvas().print(0, 0, "Uptime 3d 04:12");
+  menu.canvas().print(0, 1, "Heap", CHECK_YELLOW);
+  menu.canvas().print(6, 1, "182 KB");
+  menu.canvas().print(2, 3, " LOW BATTERY ", MINU_BACKGROUND_COLOUR_DEFAULT, CHECK_RED);
+  menu.render(rows - 1);
+  snprintf(name, sizeof(name), "%sinfo_%s", prefix, mode.name);
+  snprintf(image, sizeof(image), "%sinfo", prefix);
+  checkImage(name, image, panel);
+
+  // Redrawing every cell must not change what the partial frames left on the panel
+  uint32_t checksum = panel.checksum();
+  renderer.invalidate();
+  menu.render(rows - 1);
+  snprintf(name, sizeof(name), "%sredraw_%s", prefix, mode.name);
+  check(name, panel.checksum() == checksum);
+}
+
+int main(int argc, char **argv)
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    if (!strcmp(argv[i], "--update"))
+      update = true;
+    else
+      goldenDir = argv[i];
+  }
+
+  for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); ++i)
+  {
+    // Only the first mode writes the images with --update. The others are compared with them
+    run(modes[i], 1, 14, 5);
+    run(modes[i], 2, 8, 4);
+    update = false;
+  }
+  return failures ? 1 : 0;
+}
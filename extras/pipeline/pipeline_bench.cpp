@@ -0,0 +1,218 @@
+/*
+ * @file  pipeline_bench.cpp
+ * @brief Compares rendering straight to a slow display with the two-stage pipeline of minu_pipeline.hpp.
+ *
+ * A page of items is scrolled at a fixed input rate, as when a button is held, and each input is followed by a
+ * render. The display is a MinuPixelRenderer whose panel takes a fixed time per pixel and per transfer, as an SPI
+ * display would. Rendering directly, every frame is laid out and pushed before the next input is handled. With the
+ * pipeline, frames are laid out on the main thread and pushed by a std::thread, and frames the display has no time
+ * for are dropped.
+ *
+ * For each mode, the time from an input to the display showing its result is reported, along with the number of
+ * frames laid out, pushed and dropped, and how long the whole scroll took to handle.
+ *
+ * Build and run on a host, e.g.:
+ *   g++ -O2 -I../.. pipeline_bench.cpp -o pipeline_bench -lpthread && ./pipeline_bench [inputs] [input_ms] [ns_per_pixel]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "minu_pipeline.hpp"
+#include "minu_framebuffer.hpp"
+
+#define BENCH_INPUTS_DEFAULT        400
+#define BENCH_INPUT_MS_DEFAULT      5     // Interval between inputs, e.g. a held button repeating
+#define BENCH_NS_PER_PIXEL_DEFAULT  400   // 16-bit pixels over a 40 MHz SPI bus
+#define BENCH_US_PER_RECT           20    // Cost of starting a transfer
+#define BENCH_ITEMS                 200
+#define BENCH_COLS                  20
+#define BENCH_ROWS                  8
+#define BENCH_SCALE                 2
+
+typedef std::chrono::steady_clock BenchClock;
+
+static uint32_t nsPerPixel = BENCH_NS_PER_PIXEL_DEFAULT;
+
+/// @brief Busy-wait, since sleeping would hand the core to the other stage and hide the cost
+static void spin(uint64_t ns)
+{
+  BenchClock::time_point end = BenchClock::now() + std::chrono::nanoseconds(ns);
+  while (BenchClock::now() < end)
+    ;
+}
+
+/// @brief Panel taking as long to receive pixels as an SPI display
+struct SlowPanel
+{
+  void pushRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *pixels, size_t stride)
+  {
+    spin((uint64_t)w * h * nsPerPixel + BENCH_US_PER_RECT * 1000);
+  }
+};
+
+typedef MinuPixelRenderer<SlowPanel> Display;
+
+/// @brief Display that notes when each frame has been pushed
+struct TimedDisplay
+{
+  TimedDisplay(Display &display, std::vector<BenchClock::time_point> &shown, MinuPipeline<> *pipeline)
+      : display(display), shown(shown), pipeline(pipeline)
+  {
+  }
+
+  void begin(bool partial) { this->display.begin(partial); }
+  bool moveTo(uint16_t col, uint16_t row) { return this->display.moveTo(col, row); }
+  void print(const char *msg, uint16_t len, uint16_t fore, uint16_t back) { this->display.print(msg, len, fore, back); }
+  void printInverted(const char *msg, uint16_t len, uint16_t fore, uint16_t back)
+  {
+    this->display.printInverted(msg, len, fore, back);
+  }
+
+  void flush(void)
+  {
+    this->display.flush();
+    // Frames are numbered from 0 in both modes, one per input
+    size_t frame = (this->pipeline) ? this->pipeline->printedSequence() : this->frames++;
+    if (frame < this->shown.size())
+      this->shown[frame] = BenchClock::now();
+  }
+
+  Display &display;
+  std::vector<BenchClock::time_point> &shown;
+  MinuPipeline<> *pipeline;
+  size_t frames = 0;
+};
+
+template <class Backend>
+static void addItems(MinuBasic<Backend> &menu)
+{
+  ssize_t page = menu.addPage("PIPELINE");
+  for (int i = 0; i < BENCH_ITEMS; ++i)
+  {
+    char main[16], aux[8];
+    snprintf(main, sizeof(main), "Network %03d", i);
+    snprintf(aux, sizeof(aux), "-%d", 40 + i % 50);
+    menu.pages()[page]->addItem(NULL, main, aux);
+  }
+}
+
+static double percentile(std::vector<double> values, double p)
+{
+  if (values.empty())
+    return 0;
+  std::sort(values.begin(), values.end());
+  return values[(size_t)(p * (values.size() - 1))];
+}
+
+/// @brief Report the latency of the inputs whose result was shown. Results of dropped frames are never shown, so
+///        the latency of their inputs is that of the next frame shown
+static void report(const char *mode, const std::vector<BenchClock::time_point> &inputs,
+                   const std::vector<BenchClock::time_point> &shown, double handledMs)
+{
+  std::vector<double> latencies;
+  size_t next = shown.size();
+  std::vector<double> perInput(inputs.size(), -1);
+  for (size_t i = inputs.size(); i-- > 0;)
+  {
+    if (shown[i] != BenchClock::time_point())
+      next = i;
+    if (next < shown.size())
+      perInput[i] = std::chrono::duration<double, std::milli>(shown[next] - inputs[i]).count();
+  }
+  for (double l : perInput)
+    if (l >= 0)
+      latencies.push_back(l);
+
+  printf("%s_handled_ms %.1f\n", mode, handledMs);
+  printf("%s_latency_ms_p50 %.2f\n", mode, percentile(latencies, 0.5));
+  printf("%s_latency_ms_p95 %.2f\n", mode, percentile(latencies, 0.95));
+  printf("%s_latency_ms_max %.2f\n", mode, percentile(latencies, 1.0));
+}
+
+/// @brief Wait for the time of the next input, unless it is already late
+static void waitForInput(BenchClock::time_point start, int input, uint32_t inputMs)
+{
+  std::this_thread::sleep_until(start + std::chrono::milliseconds((uint64_t)input * inputMs));
+}
+
+static void benchDirect(int inputs, uint32_t inputMs)
+{
+  std::vector<BenchClock::time_point> inputTimes(inputs), shown(inputs);
+  Display display(SlowPanel(), BENCH_COLS, BENCH_ROWS, BENCH_SCALE);
+  MinuBasic<TimedDisplay> menu(TimedDisplay(display, shown, NULL), BENCH_COLS - 5, 5);
+  addItems(menu);
+
+  BenchClock::time_point start = BenchClock::now();
+  for (int i = 0; i < inputs; ++i)
+  {
+    waitForInput(start, i, inputMs);
+    // An input that arrives while a frame is pushed is only handled after it, so it counts from when it was due
+    inputTimes[i] = start + std::chrono::milliseconds((uint64_t)i * inputMs);
+    menu.currentPage()->moveHighlight(1, false);
+    menu.render(BENCH_ROWS - 2);
+  }
+  double handledMs = std::chrono::duration<double, std::milli>(BenchClock::now() - start).count();
+
+  printf("direct_frames_laid_out %d\n", inputs);
+  printf("direct_frames_pushed %u\n", display.stats().frames);
+  report("direct", inputTimes, shown, handledMs);
+}
+
+static void benchPipelined(int inputs, uint32_t inputMs)
+{
+  std::vector<BenchClock::time_point> inputTimes(inputs), shown(inputs);
+  MinuPipeline<> pipeline;
+  Display display(SlowPanel(), BENCH_COLS, BENCH_ROWS, BENCH_SCALE);
+  TimedDisplay output(display, shown, &pipeline);
+  MinuBasic<MinuPipelineRecorder<> > menu(MinuPipelineRecorder<>(&pipeline), BENCH_COLS - 5, 5);
+  addItems(menu);
+
+  std::thread outputThread([&] { pipeline.run(output); });
+  BenchClock::time_point start = BenchClock::now();
+  for (int i = 0; i < inputs; ++i)
+  {
+    waitForInput(start, i, inputMs);
+    inputTimes[i] = start + std::chrono::milliseconds((uint64_t)i * inputMs);
+    menu.currentPage()->moveHighlight(1, false);
+    menu.render(BENCH_ROWS - 2);
+  }
+  double handledMs = std::chrono::duration<double, std::milli>(BenchClock::now() - start).count();
+
+  // The last frame is never dropped, so the output thread is only stopped once it has been pushed
+  for (MinuPipelineStats stats = pipeline.stats(); stats.printed + stats.dropped < stats.recorded;
+       stats = pipeline.stats())
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  pipeline.stop();
+  outputThread.join();
+
+  MinuPipelineStats stats = pipeline.stats();
+  printf("pipelined_frames_laid_out %u\n", stats.recorded);
+  printf("pipelined_frames_pushed %u\n", stats.printed);
+  printf("pipelined_frames_dropped %u\n", stats.dropped);
+  report("pipelined", inputTimes, shown, handledMs);
+}
+
+int main(int argc, char **argv)
+{
+  int inputs = (argc > 1) ? atoi(argv[1]) : BENCH_INPUTS_DEFAULT;
+  uint32_t inputMs = (argc > 2) ? atoi(argv[2]) : BENCH_INPUT_MS_DEFAULT;
+  nsPerPixel = (argc > 3) ? atoi(argv[3]) : BENCH_NS_PER_PIXEL_DEFAULT;
+  if (inputs <= 0)
+  {
+    fprintf(stderr, "Usage: %s [inputs] [input_ms] [ns_per_pixel]\n", argv[0]);
+    return 2;
+  }
+
+  // One "key value" pair per line, like the other benchmarks
+  printf("inputs %d\n", inputs);
+  printf("input_interval_ms %u\n", inputMs);
+  printf("ns_per_pixel %u\n", nsPerPixel);
+  benchDirect(inputs, inputMs);
+  benchPipelined(inputs, inputMs);
+  return 0;
+}
@@ -0,0 +1,228 @@
+/*
+ * @file  probe_bench.cpp
+ * @brief Runs the probe engine of minu_probe.hpp against fake hosts on the loopback interface.
+ *
+ * Each target is a UDP socket on 127.0.0.1 served by a fake responder thread, which echoes what it receives after a
+ * delay of its own. Every tenth target never answers, as an unreachable host would, and one answers every other echo
+ * only. The engine probes all of them through MinuSocketTransport in UDP mode for a while, and the time it took to
+ * have a result for every reachable target, and for every target, is reported along with the time taken by the
+ * sequential loop it replaces, which pings each target 5 times, a second apart. The number of echoes sent to reachable
+ * and unreachable targets shows the backoff, and the results are checked against how each fake host behaves.
+ *
+ * Build and run on a host, e.g.:
+ *   g++ -O2 -I../.. probe_bench.cpp -o probe_bench -lpthread && ./probe_bench [targets] [seconds]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <poll.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "minu_probe.hpp"
+
+#define BENCH_TARGETS_DEFAULT     30
+#define BENCH_SECONDS_DEFAULT     10
+#define BENCH_INTERVAL_MS         1000
+#define BENCH_TIMEOUT_MS          500
+#define BENCH_LOSSY_TARGET        4
+#define BENCH_SEQUENTIAL_ECHOES   5     // Echoes sent to each target by the sequential loop, a second apart
+
+typedef std::chrono::steady_clock BenchClock;
+
+/// @brief Whether a fake host never answers
+static bool unreachable(size_t target) { return target % 10 == 9; }
+
+/// @brief Returns the time a fake host takes to answer
+static uint32_t delayMs(size_t target) { return 2 + (target * 7) % 40; }
+
+/// @brief Echoes datagrams sent to a set of loopback sockets, each after the delay of its fake host
+class FakeResponder
+{
+
+public:
+  bool begin(size_t count)
+  {
+    for (size_t i = 0; i < count; ++i)
+    {
+      int fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+      struct sockaddr_in address;
+      socklen_t len = sizeof(address);
+      memset(&address, 0, sizeof(address));
+      address.sin_family = AF_INET;
+      address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      if (fd < 0 || bind(fd, (struct sockaddr *)&address, sizeof(address)) ||
+          getsockname(fd, (struct sockaddr *)&address, &len))
+        return false;
+      this->_fds.push_back(fd);
+      this->_ports.push_back(ntohs(address.sin_port));
+      this->_received.push_back(0);
+    }
+    this->_running.store(true);
+    this->_thread = std::thread([this] { this->_run(); });
+    return true;
+  }
+
+  void end(void)
+  {
+    this->_running.store(false);
+    this->_thread.join();
+    for (int fd : this->_fds)
+      close(fd);
+  }
+
+  uint16_t port(size_t target) const { return this->_ports[target]; }
+
+private:
+  struct Reply
+  {
+    BenchClock::time_point due;
+    size_t target;
+    struct sockaddr_in to;
+    uint8_t data[64];
+    ssize_t len;
+  };
+
+  void _run(void)
+  {
+    std::vector<struct pollfd> fds;
+    for (int fd : this->_fds)
+      fds.push_back({fd, POLLIN, 0});
+
+    while (this->_running.load())
+    {
+      poll(fds.data(), fds.size(), 1);
+      for (size_t i = 0; i < fds.size(); ++i)
+      {
+        if (!(fds[i].revents & POLLIN))
+          continue;
+        Reply reply;
+        socklen_t len = sizeof(reply.to);
+        reply.len = recvfrom(fds[i].fd, reply.data, sizeof(reply.data), 0, (struct sockaddr *)&reply.to, &len);
+        reply.target = i;
+        reply.due = BenchClock::now() + std::chrono::milliseconds(delayMs(i));
+        bool dropped = unreachable(i) || (i == BENCH_LOSSY_TARGET && this->_received[i] % 2);
+        this->_received[i]++;
+        if (reply.len > 0 && !dropped)
+          this->_pending.push_back(reply);
+      }
+
+      BenchClock::time_point now = BenchClock::now();
+      for (size_t i = 0; i < this->_pending.size();)
+      {
+        Reply &reply = this->_pending[i];
+        if (reply.due > now)
+        {
+          i++;
+          continue;
+        }
+        sendto(this->_fds[reply.target], reply.data, reply.len, 0, (struct sockaddr *)&reply.to, sizeof(reply.to));
+        this->_pending.erase(this->_pending.begin() + i);
+      }
+    }
+  }
+
+  std::vector<int> _fds;
+  std::vector<uint16_t> _ports;
+  std::vector<uint32_t> _received;
+  std::vector<Reply> _pending;
+  std::atomic<bool> _running;
+  std::thread _thread;
+};
+
+struct BenchState
+{
+  BenchClock::time_point start;
+  std::vector<double> firstResultMs;
+  std::vector<uint32_t> downReports;
+};
+
+static void resultReceived(size_t target, const MinuProbeResult &result, void *arg)
+{
+  BenchState *state = (BenchState *)arg;
+  if (state->firstResultMs[target] < 0)
+    state->firstResultMs[target] = std::chrono::duration<double, std::milli>(BenchClock::now() - state->start).count();
+  if (result.state == MINU_PROBE_DOWN)
+    state->downReports[target]++;
+}
+
+int main(int argc, char **argv)
+{
+  size_t targets = (argc > 1) ? atoi(argv[1]) : BENCH_TARGETS_DEFAULT;
+  uint32_t seconds = (argc > 2) ? atoi(argv[2]) : BENCH_SECONDS_DEFAULT;
+  if (!targets || targets > MINU_PROBE_TARGET_MAX || targets <= BENCH_LOSSY_TARGET || !seconds)
+  {
+    fprintf(stderr, "Usage: %s [targets, %d to %d] [seconds]\n", argv[0], BENCH_LOSSY_TARGET + 1, MINU_PROBE_TARGET_MAX);
+    return 2;
+  }
+
+  FakeResponder responder;
+  if (!responder.begin(targets))
+  {
+    fprintf(stderr, "Cannot open the fake hosts' sockets\n");
+    return 1;
+  }
+
+  BenchState state;
+  state.firstResultMs.assign(targets, -1);
+  state.downReports.assign(targets, 0);
+  MinuProbeEngine<MinuSocketTransport> engine(MinuSocketTransport(7));
+  engine.setCallback(resultReceived, &state);
+  for (size_t i = 0; i < targets; ++i)
+  {
+    char host[MINU_PROBE_HOST_LEN];
+    snprintf(host, sizeof(host), "127.0.0.1:%u", responder.port(i));
+    engine.addTarget(host, BENCH_INTERVAL_MS, BENCH_TIMEOUT_MS);
+  }
+
+  state.start = BenchClock::now();
+  engine.start();
+  while (BenchClock::now() - state.start < std::chrono::seconds(seconds))
+    engine.poll(MINU_PROBE_POLL_MS);
+  responder.end();
+
+  size_t unreachableCount = 0, wrong = 0;
+  uint32_t reachableEchoes = 0, unreachableEchoes = 0, rttErrorMax = 0;
+  double filledMs = 0, reachableFilledMs = 0, firstMs = -1;
+  for (size_t i = 0; i < targets; ++i)
+  {
+    const MinuProbeResult &result = engine.result(i);
+    filledMs = (state.firstResultMs[i] > filledMs) ? state.firstResultMs[i] : filledMs;
+    if (state.firstResultMs[i] >= 0 && (firstMs < 0 || state.firstResultMs[i] < firstMs))
+      firstMs = state.firstResultMs[i];
+    if (state.firstResultMs[i] < 0)
+      wrong++;
+
+    if (unreachable(i))
+    {
+      unreachableCount++;
+      unreachableEchoes += result.sent;
+      wrong += (result.state != MINU_PROBE_DOWN);
+      continue;
+    }
+    reachableEchoes += result.sent;
+    if (state.firstResultMs[i] > reachableFilledMs)
+      reachableFilledMs = state.firstResultMs[i];
+    // The lossy host loses at most one echo in a row, so it is never reported unreachable
+    wrong += (result.state != MINU_PROBE_UP || state.downReports[i] != 0);
+    uint32_t error = (result.rttMs > delayMs(i)) ? result.rttMs - delayMs(i) : delayMs(i) - result.rttMs;
+    rttErrorMax = (error > rttErrorMax) ? error : rttErrorMax;
+  }
+
+  // One "key value" pair per line, like the other benchmarks
+  printf("targets %zu\n", targets);
+  printf("unreachable_targets %zu\n", unreachableCount);
+  printf("seconds %u\n", seconds);
+  printf("first_result_ms %.1f\n", firstMs);
+  printf("reachable_filled_ms %.1f\n", reachableFilledMs);
+  printf("page_filled_ms %.1f\n", filledMs);
+  printf("sequential_fill_ms %u\n", (uint32_t)targets * BENCH_SEQUENTIAL_ECHOES * 1000);
+  printf("echoes_per_reachable_target %.1f\n", (double)reachableEchoes / (targets - unreachableCount));
+  printf("echoes_per_unreachable_target %.1f\n", (unreachableCount) ? (double)unreachableEchoes / unreachableCount : 0);
+  printf("lossy_target_echoes %u\n", engine.result(BENCH_LOSSY_TARGET).sent);
+  printf("rtt_error_ms_max %u\n", rttErrorMax);
+  printf("wrong_results %zu\n", wrong);
+  return wrong ? 1 : 0;
+}
@@ -0,0 +1,232 @@
+/*
+ * @file  minu_replay.cpp
+ * @brief Replays a session log recorded with MinuRecorder (minu_record.hpp) and reports the cost of each frame.
+ *
+ * The recorded state changes are applied to a Minu on the host, which renders every recorded frame into a backend
+ * that only counts what it is given. Time is taken from the log rather than the host clock, so two builds replaying
+ * the same log render exactly the same frames and their costs can be compared directly.
+ *
+ * Build and run on a host, e.g.:
+ *   g++ -O2 -I../.. minu_replay.cpp -o minu_replay && ./minu_replay session.bin [--repeat N] [--csv frames.csv]
+ *
+ * With --repeat, the whole session is replayed N times and the fastest time of each frame is kept. With --csv, one
+ * line per frame is written: log time, page, partial, render time, bytes printed, print calls.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "minu_record.hpp"
+
+/// @brief Backend that copies what it is given into a scratch line, as a display driver would, and counts it
+struct CountingBackend
+{
+  void print(const char *msg, uint16_t len, uint16_t fore, uint16_t back) { this->_count(msg, len); }
+  void printInverted(const char *msg, uint16_t len, uint16_t fore, uint16_t back) { this->_count(msg, len); }
+  void begin(bool partial) {}
+  bool moveTo(uint16_t col, uint16_t row) { return true; }
+  void flush(void) {}
+
+  size_t bytes = 0;
+  size_t calls = 0;
+  char line[256];
+
+private:
+  void _count(const char *msg, uint16_t len)
+  {
+    // Texts are passed whole and may be shorter or longer than len, so only as much as fits the line is copied
+    size_t n = strnlen(msg, (len < sizeof(this->line)) ? len : sizeof(this->line));
+    memcpy(this->line, msg, n);
+    this->bytes += len;
+    this->calls++;
+  }
+};
+
+struct FrameCost
+{
+  uint32_t time;
+  ssize_t page;
+  bool partial;
+  double renderUs;
+  size_t bytes;
+  size_t calls;
+};
+
+/// @brief  Replay the log once
+/// @return false, if the log was malformed
+static bool replay(const std::vector<uint8_t> &log, std::vector<FrameCost> &frames)
+{
+  MinuRecordReader reader(log.data(), log.size());
+  if (reader.error())
+    return false;
+
+  MinuBasic<CountingBackend> menu(CountingBackend(), reader.mainTextLength(), reader.auxTextLength());
+  std::vector<ssize_t> pageIds;
+  MinuRecord record;
+  size_t frame = 0;
+  while (reader.next(record))
+  {
+    MinuPage *page = menu.currentPage();
+    switch (record.type)
+    {
+    case MINU_RECORD_PAGE:
+    {
+      // Pages are created the first time they are shown, so replay ids need not match the recorded ones
+      if ((size_t)record.index >= pageIds.size())
+        pageIds.resize(record.index + 1, -1);
+      std::string title(record.text, record.textLen);
+      if (pageIds[record.index] < 0)
+        pageIds[record.index] = menu.addPage(MinuPage(title.c_str(), menu.numPages(), record.flag));
+      if (menu.currentPageId() != pageIds[record.index])
+        menu.goToPage(pageIds[record.index]);
+
+      page = menu.currentPage();
+      page->setTitle(title.c_str());
+      while (page->getItemCount() > record.value)
+        page->removeItem(page->getItemCount() - 1);
+      while (page->getItemCount() < record.value)
+        page->addItem(NULL, NULL, NULL);
+      break;
+    }
+    case MINU_RECORD_ITEM:
+      if (page && (size_t)record.index < page->getItemCount())
+      {
+        MinuPageItem &item = page->items()[record.index];
+        item.setMainText(std::string(record.text, record.textLen).c_str());
+        item.setAuxText(std::string(record.aux, record.auxLen).c_str());
+        item.setStatus(item.status(), record.fore, record.back);
+      }
+      break;
+    case MINU_RECORD_HIGHLIGHT:
+      if (page && record.index >= 0)
+        page->highlightItem(record.index);
+      break;
+    case MINU_RECORD_CANVAS_SIZE:
+      menu.canvas().resize(record.index, record.value);
+      break;
+    case MINU_RECORD_CANVAS_RUN:
+      menu.canvas().print(record.value, record.index, std::string(record.text, record.textLen).c_str(), record.fore,
+                          record.back);
+      break;
+    case MINU_RECORD_FRAME:
+    {
+      CountingBackend &backend = menu.backend();
+      size_t bytes = backend.bytes, calls = backend.calls;
+      auto start = std::chrono::steady_clock::now();
+      if (record.flag)
+        menu.renderCanvas();
+      else
+        menu.render(reader.renderCount());
+      double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+      if (frame == frames.size())
+        frames.push_back(FrameCost{record.time, menu.currentPageId(), record.flag, us, 0, 0});
+      FrameCost &cost = frames[frame++];
+      cost.renderUs = std::min(cost.renderUs, us);
+      cost.bytes = backend.bytes - bytes;
+      cost.calls = backend.calls - calls;
+      break;
+    }
+    default:
+      // Inputs and links are already reflected in the state changes that follow them
+      break;
+    }
+  }
+  return !reader.error();
+}
+
+static double percentile(std::vector<double> values, double p)
+{
+  if (values.empty())
+    return 0;
+  std::sort(values.begin(), values.end());
+  return values[(size_t)(p * (values.size() - 1))];
+}
+
+int main(int argc, char **argv)
+{
+  if (argc < 2)
+  {
+    fprintf(stderr, "Usage: %s session.bin [--repeat N] [--csv frames.csv]\n", argv[0]);
+    return 2;
+  }
+
+  int repeat = 1;
+  const char *csvPath = NULL;
+  for (int i = 2; i + 1 < argc; i += 2)
+  {
+    if (!strcmp(argv[i], "--repeat"))
+      repeat = atoi(argv[i + 1]);
+    else if (!strcmp(argv[i], "--csv"))
+      csvPath = argv[i + 1];
+  }
+
+  FILE *in = fopen(argv[1], "rb");
+  if (!in)
+  {
+    perror(argv[1]);
+    return 2;
+  }
+  std::vector<uint8_t> log;
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), in)) > 0)
+    log.insert(log.end(), chunk, chunk + n);
+  fclose(in);
+
+  std::vector<FrameCost> frames;
+  for (int r = 0; r < repeat; ++r)
+  {
+    if (!replay(log, frames))
+    {
+      fprintf(stderr, "%s: malformed log after %zu frames\n", argv[1], frames.size());
+      return 1;
+    }
+  }
+
+  std::vector<double> times;
+  size_t bytes = 0, calls = 0, partial = 0;
+  for (const FrameCost &f : frames)
+  {
+    times.push_back(f.renderUs);
+    bytes += f.bytes;
+    calls += f.calls;
+    partial += f.partial;
+  }
+
+  // One "key value" pair per line, so that the output of two builds can be diffed or parsed by CI
+  printf("log_bytes %zu\n", log.size());
+  printf("session_ms %u\n", frames.empty() ? 0 : frames.back().time);
+  printf("frames %zu\n", frames.size());
+  printf("partial_frames %zu\n", partial);
+  printf("bytes_printed %zu\n", bytes);
+  printf("print_calls %zu\n", calls);
+  double total = 0;
+  for (double t : times)
+    total += t;
+  printf("render_us_total %.1f\n", total);
+  printf("render_us_mean %.2f\n", times.empty() ? 0 : total / times.size());
+  printf("render_us_p50 %.2f\n", percentile(times, 0.5));
+  printf("render_us_p95 %.2f\n", percentile(times, 0.95));
+  printf("render_us_max %.2f\n", percentile(times, 1.0));
+
+  if (csvPath)
+  {
+    FILE *csv = fopen(csvPath, "w");
+    if (!csv)
+    {
+      perror(csvPath);
+      return 2;
+    }
+    fprintf(csv, "time_ms,page,partial,render_us,bytes,calls\n");
+    for (const FrameCost &f : frames)
+      fprintf(csv, "%u,%zd,%d,%.2f,%zu,%zu\n", f.time, f.page, f.partial, f.renderUs, f.bytes, f.calls);
+    fclose(csv);
+  }
+  return 0;
+}
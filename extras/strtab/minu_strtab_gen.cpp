@@ -0,0 +1,104 @@
+/*
+ * @file  minu_strtab_gen.cpp
+ * @brief Generates the source of a compressed string table (minu_strtab.hpp) from a list of entries.
+ *
+ * Each line of the input is either a tab-separated text and value, or a definition of the form found in the ESP8266
+ * and ESP32 cores' TZ.h, i.e. #define NAME PSTR("VALUE"). Other lines are ignored. Entries keep the order of the input.
+ *
+ * Build and run on a host, e.g.:
+ *   g++ -O2 -I../.. minu_strtab_gen.cpp -o minu_strtab_gen
+ *   ./minu_strtab_gen TZ.h tzTable --strip TZ_ --include ../../minu_strtab.hpp > tz_table.h
+ *
+ * The sizes of the table and of the input's texts and values stored as separate literals are printed to stderr.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#include "minu_strtab.hpp"
+
+/// @brief  Split a line into a text and a value
+/// @return false, if the line holds no entry
+static bool parseLine(const std::string &line, std::string &text, std::string &value)
+{
+  size_t tab = line.find('\t');
+  if (!line.compare(0, 8, "#define "))
+  {
+    // #define NAME PSTR("VALUE")
+    size_t name = line.find_first_not_of(" \t", 8);
+    size_t nameEnd = line.find_first_of(" \t", name);
+    size_t open = line.find("(\"", nameEnd);
+    size_t close = line.rfind("\")");
+    if (name == std::string::npos || nameEnd == std::string::npos || open == std::string::npos ||
+        close == std::string::npos || close < open)
+      return false;
+    text = line.substr(name, nameEnd - name);
+    value = line.substr(open + 2, close - open - 2);
+    return true;
+  }
+  if (line.empty() || line[0] == '#' || line[0] == '/' || tab == std::string::npos)
+    return false;
+  text = line.substr(0, tab);
+  value = line.substr(tab + 1);
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc < 3)
+  {
+    fprintf(stderr, "Usage: %s input name [--strip PREFIX] [--include HEADER]\n", argv[0]);
+    return 2;
+  }
+
+  const char *strip = "";
+  const char *include = "minu_strtab.hpp";
+  for (int i = 3; i + 1 < argc; i += 2)
+  {
+    if (!strcmp(argv[i], "--strip"))
+      strip = argv[i + 1];
+    else if (!strcmp(argv[i], "--include"))
+      include = argv[i + 1];
+  }
+
+  FILE *in = fopen(argv[1], "r");
+  if (!in)
+  {
+    perror(argv[1]);
+    return 2;
+  }
+
+  MinuStringTableBuilder builder;
+  size_t literalBytes = 0;
+  char buff[1024];
+  while (fgets(buff, sizeof(buff), in))
+  {
+    std::string line(buff), text, value;
+    while (!line.empty() && (line.back() == '\n' || line.back() == '\r'))
+      line.pop_back();
+    if (!parseLine(line, text, value))
+      continue;
+    if (!text.compare(0, strlen(strip), strip))
+      text.erase(0, strlen(strip));
+    if (!builder.add(text.c_str(), value.c_str()))
+    {
+      fprintf(stderr, "%s: too many entries\n", argv[1]);
+      return 1;
+    }
+    literalBytes += text.size() + 1 + value.size() + 1 + 2 * sizeof(const char *);
+  }
+  fclose(in);
+
+  MinuStringTable table = builder.table();
+  printf("// ! ! ! DO NOT EDIT, AUTOMATICALLY GENERATED ! ! !\n");
+  printf("// Generated from %s by extras/strtab/minu_strtab_gen.cpp: %u entries, %zu bytes\n\n", argv[1],
+         table.count, builder.size());
+  printf("#pragma once\n\n#include \"%s\"\n\n", include);
+  if (!builder.write(stdout, argv[2]))
+    return 1;
+
+  fprintf(stderr, "%u entries, %u distinct values\n", table.count, table.valueCount);
+  fprintf(stderr, "table %zu bytes, as separate literals and pointers %zu bytes\n", builder.size(), literalBytes);
+  return 0;
+}
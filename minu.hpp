@@ -11,14 +11,63 @@
 #include <stdint.h>
 #include <string.h>
 #include <stdio.h>
+#include <stdarg.h>
 #include <vector>
+#include <atomic>
+#include <utility>
+#include <algorithm>
+
+// Arduino provides its own String class. Elsewhere (e.g. host-side tools) std::string is used instead
+#ifdef ARDUINO
+#include <Arduino.h>
+typedef String MinuString;
+#else
+#include <string>
+typedef std::string MinuString;
+#endif
 
 #define MINU_ITEM_TEXT_SEPARATOR_DEFAULT  "|"   // Separates the main and auxiliary text sections of a menu item
 #define MINU_TITLE_PADDING_DEFAULT        "_"   // Padding character for page title
+// Building with MINU_PALETTE defined makes every colour a 4-bit index into a MinuPalette held by the backend,
+// rather than an RGB565 value, so that items and cells store their colours in a byte
+#ifdef MINU_PALETTE
+#define MINU_FOREGROUND_COLOUR_DEFAULT    MINU_PALETTE_WHITE  // Text foreground default colour
+#define MINU_BACKGROUND_COLOUR_DEFAULT    MINU_PALETTE_BLACK  // Text background default colour
+#else
 #define MINU_FOREGROUND_COLOUR_DEFAULT    0xFFFF// Text foreground default colour
 #define MINU_BACKGROUND_COLOUR_DEFAULT    0x0000// Text background default colour
+#endif
+#define MINU_PALETTE_SIZE                 16    // Number of colours in a MinuPalette
 #define MINU_AUX_TEXT_LEN_DEFAULT         0
 #define MINU_MAIN_TEXT_LEN_DEFAULT        10
+#define MINU_STATUS_CHANGED               0x80  // Flag set in an item's status word until the item is next rendered
+#define MINU_STATUS_KEYED                 0x10000  // Flag set in an item's status word once its id() is a key
+#define MINU_CANVAS_PRINTF_LEN_DEFAULT    64  // Size of the buffer used by MinuTextCanvas::printf()
+#define MINU_PRINT_BUFF_LEN               32  // Size of the buffer render() prints repeated characters from
+
+/// @brief Application-defined states an item's status can take, e.g. the result of a connectivity check
+enum MinuItemStatus
+{
+  MINU_STATUS_NONE = 0,
+  MINU_STATUS_OK,
+  MINU_STATUS_WARNING,
+  MINU_STATUS_ERROR,
+  MINU_STATUS_BUSY,
+  MINU_STATUS_USER = 0x40,  // First value free for application-specific states
+};
+
+/// @brief Indices of the colours a MinuPalette starts with. Entries from MINU_PALETTE_USER on start black
+enum MinuPaletteIndex
+{
+  MINU_PALETTE_BLACK = 0,
+  MINU_PALETTE_WHITE,
+  MINU_PALETTE_RED,
+  MINU_PALETTE_GREEN,
+  MINU_PALETTE_BLUE,
+  MINU_PALETTE_YELLOW,
+  MINU_PALETTE_GREY,
+  MINU_PALETTE_USER,  // First index free for application-specific colours
+};
 
 /// @brief Generic callback function executed when a menu event occurs
 typedef void (*MinuCallbackFunction)(void *);						
@@ -28,15 +77,473 @@ typedef void (*MinuCallbackFunction)(void *);
 /// @param len  Number of characters to print.
 /// @note       If \a len is less than the length of \a msg, the text should be truncated to len
 /// @note       If \a len is greater than the length of \a msg, the text should padded with spaces to len characters
+/// @note       \a msg may be much longer than \a len, e.g. an item's full text, so only read up to \a len characters
 /// @param fore Text foreground colour
 /// @param back Text background colour
-typedef void (*MinuPrintFunction)(const char * msg, uint8_t len, uint16_t fore, uint16_t back);
+typedef void (*MinuPrintFunction)(const char * msg, uint16_t len, uint16_t fore, uint16_t back);
+
+/// @brief  Function checked while rendering part of a frame, see MinuBasic::renderPart()
+/// @return true, once the time available for rendering is used up
+typedef bool (*MinuBudgetFunction)(void *arg);
+
+/// @brief     Function for moving the print position of the display to a character cell
+/// @param col Column of the cell, counting from the left edge of the menu
+/// @param row Row of the cell, counting from the top edge of the menu
+typedef void (*MinuCursorFunction)(uint16_t col, uint16_t row);
 
 // ssize_t is undefined on Arduino
 #ifdef ARDUINO
 typedef int ssize_t;
 #endif 
 
+/// @brief Interface for receiving a copy of everything a Minu prints while rendering.
+/// @note  This allows the rendered output to be mirrored elsewhere (e.g. to a host over a serial link)
+///        without modifying the user-defined print functions.
+class MinuRenderObserver
+{
+public:
+  virtual ~MinuRenderObserver() {}
+
+  /// @brief Called before the first text fragment of a frame is printed
+  /// @param pageId           Index of the page being rendered
+  /// @param highlightedIndex Index of the page's highlighted item
+  /// @param partial          Whether the frame only updates cells of the previous frame in place, rather than
+  ///                         replacing it. Each fragment of a partial frame is preceded by a call to cursorMoved()
+  virtual void frameStarted(ssize_t /*pageId*/, ssize_t /*highlightedIndex*/, bool /*partial*/) {}
+
+  /// @brief Called when the print position is moved to the given character cell
+  virtual void cursorMoved(uint16_t /*col*/, uint16_t /*row*/) {}
+
+  /// @brief    Called for every text fragment printed, with the same arguments passed to the print function
+  /// @note     With MINU_PALETTE, \a fore and \a back are indices into the backend's palette rather than RGB565
+  /// @param inverted Whether the fragment was printed using the inverted print function
+  virtual void fragmentPrinted(const char *msg, uint16_t len, uint16_t fore, uint16_t back, bool inverted) = 0;
+
+  /// @brief Called after the last text fragment of a frame is printed
+  virtual void frameFinished(void) {}
+};
+
+class MinuPage;
+
+/// @brief Interface for deferring the callbacks made while navigating a Minu, e.g. to another task.
+/// @note  A page passes its opened, closed and item highlighted callbacks to its dispatcher rather than calling them
+///        itself. A dispatcher that accepts a call becomes responsible for making it later.
+class MinuCallbackDispatcher
+{
+public:
+  virtual ~MinuCallbackDispatcher() {}
+
+  /// @brief  Called in place of a page or item callback
+  /// @param  cb        Callback to call
+  /// @param  page      Page the callback belongs to
+  /// @param  itemIndex Index of the item the callback belongs to, or -1 for a page callback
+  /// @return false, if the call could not be deferred, in which case it is made immediately
+  virtual bool dispatch(MinuCallbackFunction cb, MinuPage *page, ssize_t itemIndex) = 0;
+};
+
+/// @brief Bytes of RAM used by a Minu, by what they are used for
+/// @note  Heap figures are estimates: they count the blocks the library asked for, not the allocator's own overhead
+struct MinuMemoryUsage
+{
+  size_t pages;   // Page objects and the vectors that hold them
+  size_t items;   // Item objects, including the unused capacity of the item vectors
+  size_t text;    // Heap storage of titles and item texts
+  size_t caches;  // Canvas grids and any other copies kept to skip unchanged output
+  size_t scratch; // Buffers that only exist while rendering, e.g. on the stack
+
+  MinuMemoryUsage() : pages(0), items(0), text(0), caches(0), scratch(0) {}
+
+  /// @brief Returns the sum of all categories
+  size_t total() const { return this->pages + this->items + this->text + this->caches + this->scratch; }
+
+  MinuMemoryUsage &operator+=(const MinuMemoryUsage &other)
+  {
+    this->pages += other.pages;
+    this->items += other.items;
+    this->text += other.text;
+    this->caches += other.caches;
+    this->scratch += other.scratch;
+    return *this;
+  }
+};
+
+/// @brief Returns the heap bytes held by a string, not counting the string object itself
+static inline size_t minuStringHeapBytes(const MinuString &str)
+{
+  // Short strings may be stored inside the object, in which case they take no heap at all
+  const char *data = str.c_str();
+  if (!data || (data >= (const char *)&str && data < (const char *)(&str + 1)))
+    return 0;
+#ifdef ARDUINO
+  return str.length() + 1;
+#else
+  return str.capacity() + 1;
+#endif
+}
+
+/// @brief Returns a 32-bit key for a text, e.g. a network's BSSID, to identify an item by in MinuPage::reconcile()
+/// @note  FNV-1a hash. Distinct texts may collide, in which case reconcile() treats the second as a new item
+static inline uint32_t minuKey(const char *text)
+{
+  uint32_t hash = 2166136261u;
+  while (text && *text)
+    hash = (hash ^ (uint8_t)*text++) * 16777619u;
+  return hash;
+}
+
+/// @brief Table of the RGB565 colours that the palette indices of a MINU_PALETTE build stand for
+class MinuPalette
+{
+
+public:
+  MinuPalette() { this->reset(); }
+
+  /// @brief Restore the colours of MinuPaletteIndex, and set the other entries to black
+  void reset(void)
+  {
+    static const uint16_t defaults[MINU_PALETTE_USER] = {0x0000, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFE0, 0x8410};
+    memset(this->_colours, 0, sizeof(this->_colours));
+    memcpy(this->_colours, defaults, sizeof(defaults));
+  }
+
+  /// @brief  Set the colour of an entry
+  /// @return false, if the index is out of range
+  bool set(uint8_t index, uint16_t colour)
+  {
+    if (index >= MINU_PALETTE_SIZE)
+      return false;
+    this->_colours[index] = colour;
+    return true;
+  }
+
+  bool operator==(const MinuPalette &other) const { return !memcmp(this->_colours, other._colours, sizeof(this->_colours)); }
+  bool operator!=(const MinuPalette &other) const { return !(*this == other); }
+
+  /// @brief Returns the RGB565 colour of an entry. Only the low 4 bits of \a index are used
+  uint16_t colour(uint16_t index) const { return this->_colours[index & (MINU_PALETTE_SIZE - 1)]; }
+
+  /// @brief  Returns the index of an RGB565 colour
+  /// @return -1, if the colour is not in the palette
+  int8_t find(uint16_t colour) const
+  {
+    for (uint8_t i = 0; i < MINU_PALETTE_SIZE; ++i)
+      if (this->_colours[i] == colour)
+        return i;
+    return -1;
+  }
+
+private:
+  uint16_t _colours[MINU_PALETTE_SIZE];
+};
+
+/// @brief A single character position on the display
+/// @note  With MINU_PALETTE defined, the colours are palette indices and a cell takes two bytes rather than six
+struct MinuCell
+{
+  MinuCell() = default;
+  MinuCell(char ch, uint16_t fore, uint16_t back) : ch(ch), fore(fore), back(back) {}
+
+  char ch;
+#ifdef MINU_PALETTE
+  uint8_t fore : 4;
+  uint8_t back : 4;
+#else
+  uint16_t fore;
+  uint16_t back;
+#endif
+
+  bool operator==(const MinuCell &other) const
+  {
+    return this->ch == other.ch && this->fore == other.fore && this->back == other.back;
+  }
+  bool operator!=(const MinuCell &other) const { return !(*this == other); }
+};
+
+/// @brief Fixed-size grid of character cells, stored row by row
+class MinuCellGrid
+{
+
+public:
+  /// @brief Class constructor
+  /// @param cols Number of characters per row
+  /// @param rows Number of rows
+  MinuCellGrid(uint16_t cols = 0, uint16_t rows = 0)
+  {
+    this->resize(cols, rows);
+  }
+
+  /// @brief Change the dimensions of the grid
+  /// @note  All cells are cleared to blank cells with the default colours
+  void resize(uint16_t cols, uint16_t rows)
+  {
+    this->_cols = cols;
+    this->_rows = rows;
+    this->_cells.resize((size_t)cols * rows);
+    this->clear();
+  }
+
+  /// @brief Fill every cell with spaces printed in the given colours
+  void clear(uint16_t fore = MINU_FOREGROUND_COLOUR_DEFAULT, uint16_t back = MINU_BACKGROUND_COLOUR_DEFAULT)
+  {
+    MinuCell blank = {' ', fore, back};
+    for (size_t i = 0; i < this->_cells.size(); ++i)
+      this->_cells[i] = blank;
+  }
+
+  /// @brief Returns the number of characters per row
+  uint16_t cols() const { return this->_cols; }
+
+  /// @brief Returns the number of rows
+  uint16_t rows() const { return this->_rows; }
+
+  /// @brief Returns a pointer to the first cell of the given row
+  MinuCell *row(uint16_t r) { return &this->_cells[(size_t)r * this->_cols]; }
+  const MinuCell *row(uint16_t r) const { return &this->_cells[(size_t)r * this->_cols]; }
+
+  /// @brief Returns a reference to the cell at the given position
+  /// @note  The position is not bounds-checked
+  MinuCell &at(uint16_t col, uint16_t r) { return this->_cells[(size_t)r * this->_cols + col]; }
+  const MinuCell &at(uint16_t col, uint16_t r) const { return this->_cells[(size_t)r * this->_cols + col]; }
+
+  /// @brief Whether the given position lies within the grid
+  bool contains(uint16_t col, uint16_t r) const { return col < this->_cols && r < this->_rows; }
+
+  /// @brief Copy the contents of another grid of identical dimensions
+  /// @return false, if the dimensions differ
+  bool copyFrom(const MinuCellGrid &other)
+  {
+    if (other._cols != this->_cols || other._rows != this->_rows)
+      return false;
+    this->_cells = other._cells;
+    return true;
+  }
+
+  /// @brief Returns the heap bytes used by the cells
+  size_t memoryUsage() const { return this->_cells.capacity() * sizeof(MinuCell); }
+
+private:
+  uint16_t _cols;
+  uint16_t _rows;
+  std::vector<MinuCell> _cells;
+};
+
+/// @brief Writes text fragments into a MinuCellGrid following the MinuPrintFunction contract.
+/// @note  Text flows from the current cursor position, '\n' moves the cursor to the start of the next row,
+///        and anything falling outside the grid is clipped rather than wrapped.
+/// @note  The writer only holds the cursor, so that classes embedding a writer and a grid remain copyable.
+class MinuGridWriter
+{
+
+public:
+  MinuGridWriter() { this->home(); }
+
+  /// @brief Move the cursor to the top-left cell
+  void home(void) { this->moveTo(0, 0); }
+
+  /// @brief Move the cursor to the given position
+  void moveTo(uint16_t col, uint16_t row)
+  {
+    this->_col = col;
+    this->_row = row;
+  }
+
+  /// @brief Returns the cursor column
+  uint16_t col() const { return this->_col; }
+
+  /// @brief Returns the cursor row
+  uint16_t row() const { return this->_row; }
+
+  /// @brief Write a text fragment at the cursor position
+  /// @param grid     Grid written to
+  /// @param msg      Text to be written
+  /// @param len      Number of characters to write. \a msg is truncated or padded with spaces to \a len
+  /// @param fore     Text foreground colour
+  /// @param back     Text background colour
+  /// @param inverted Whether the fragment was printed inverted, i.e. with its colours swapped
+  void write(MinuCellGrid &grid, const char *msg, uint16_t len, uint16_t fore, uint16_t back, bool inverted = false)
+  {
+    if (!msg)
+      return;
+
+    MinuCell cell;
+    cell.fore = (inverted) ? back : fore;
+    cell.back = (inverted) ? fore : back;
+
+    bool padding = false;
+    for (uint16_t i = 0; i < len; ++i)
+    {
+      // Once the end of the message is reached, the rest of the fragment is padded with spaces
+      if (!padding && !msg[i])
+        padding = true;
+      cell.ch = (padding) ? ' ' : msg[i];
+
+      if (cell.ch == '\n')
+      {
+        this->_col = 0;
+        this->_row++;
+        continue;
+      }
+
+      if (grid.contains(this->_col, this->_row))
+        grid.at(this->_col, this->_row) = cell;
+      this->_col++;
+    }
+  }
+
+private:
+  uint16_t _col;
+  uint16_t _row;
+};
+
+/// @brief Retained text drawn below the title of an info-mode page.
+/// @note  Text written to the canvas stays there until it is overwritten or cleared, so that a page only needs to
+///        write what changed. When the canvas is rendered, only the cells that differ from what was last printed
+///        are sent to the display. See MinuBasic::renderCanvas().
+/// @note  A canvas has no cells until it is given a size, in which case info pages are rendered as before.
+class MinuTextCanvas
+{
+
+public:
+  /// @brief Class constructor
+  /// @param cols Number of characters per row
+  /// @param rows Number of rows
+  MinuTextCanvas(uint16_t cols = 0, uint16_t rows = 0)
+  {
+    this->setTextColour(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+    this->resize(cols, rows);
+  }
+
+  /// @brief Change the dimensions of the canvas, clearing its contents
+  void resize(uint16_t cols, uint16_t rows)
+  {
+    this->_content.resize(cols, rows);
+    this->_shown.resize(cols, rows);
+    this->clear();
+    this->invalidate();
+  }
+
+  /// @brief Returns the number of characters per row
+  uint16_t cols() const { return this->_content.cols(); }
+
+  /// @brief Returns the number of rows
+  uint16_t rows() const { return this->_content.rows(); }
+
+  /// @brief Fill the canvas with spaces and move the cursor to the top-left cell
+  void clear(void)
+  {
+    this->_content.clear();
+    this->_writer.home();
+    this->_dirty = true;
+  }
+
+  /// @brief Fill a row with spaces, leaving the cursor at its start
+  void clearRow(uint16_t row)
+  {
+    if (row >= this->rows())
+      return;
+
+    MinuCell blank = {' ', MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT};
+    for (uint16_t c = 0; c < this->cols(); ++c)
+      this->_content.at(c, row) = blank;
+    this->_writer.moveTo(0, row);
+    this->_dirty = true;
+  }
+
+  /// @brief Set the colours used by subsequent writes
+  void setTextColour(uint16_t fore, uint16_t back)
+  {
+    this->_fore = fore;
+    this->_back = back;
+  }
+
+  /// @brief Move the cursor to the given position
+  void setCursor(uint16_t col, uint16_t row) { this->_writer.moveTo(col, row); }
+
+  /// @brief Write text at the cursor position in the current colours
+  /// @note  '\n' moves the cursor to the start of the next row. Text falling outside the canvas is clipped
+  void print(const char *text)
+  {
+    if (!text)
+      return;
+
+    size_t len = strlen(text);
+    while (len)
+    {
+      uint16_t chunk = (len > 0xFFFF) ? 0xFFFF : len;
+      this->_writer.write(this->_content, text, chunk, this->_fore, this->_back);
+      text += chunk;
+      len -= chunk;
+    }
+    this->_dirty = true;
+  }
+
+  /// @brief Write text at the given position in the given colours
+  void print(uint16_t col, uint16_t row, const char *text, uint16_t fore = MINU_FOREGROUND_COLOUR_DEFAULT,
+             uint16_t back = MINU_BACKGROUND_COLOUR_DEFAULT)
+  {
+    this->setCursor(col, row);
+    this->setTextColour(fore, back);
+    this->print(text);
+  }
+
+  /// @brief  Write formatted text at the cursor position in the current colours
+  /// @note   At most MINU_CANVAS_PRINTF_LEN_DEFAULT - 1 characters are written
+  /// @return Number of characters the formatted text would have had, or a negative value on error
+  int printf(const char *format, ...)
+#if defined(__GNUC__)
+      __attribute__((format(printf, 2, 3)))
+#endif
+  {
+    char buff[MINU_CANVAS_PRINTF_LEN_DEFAULT];
+    va_list args;
+    va_start(args, format);
+    int ret = vsnprintf(buff, sizeof(buff), format, args);
+    va_end(args);
+
+    if (ret >= 0)
+      this->print(buff);
+    return ret;
+  }
+
+  /// @brief Whether the canvas was written to since it was last rendered
+  bool dirty() const { return this->_dirty; }
+
+  /// @brief Returns the current contents of the canvas
+  const MinuCellGrid &content() const { return this->_content; }
+
+  /// @brief Returns the contents of the canvas when it was last rendered
+  const MinuCellGrid &shown() const { return this->_shown; }
+
+  /// @brief Record that the current contents have been printed
+  void markShown(void)
+  {
+    this->_shown.copyFrom(this->_content);
+    this->_dirty = false;
+  }
+
+  /// @brief Force every cell to be printed on the next render
+  void invalidate(void)
+  {
+    // No character written to the canvas is a NUL, so every cell will compare as changed
+    for (uint16_t r = 0; r < this->_shown.rows(); ++r)
+      for (uint16_t c = 0; c < this->_shown.cols(); ++c)
+        this->_shown.at(c, r).ch = 0;
+    this->_dirty = true;
+  }
+
+  /// @brief Returns the heap bytes used by the current and last rendered contents
+  size_t memoryUsage() const { return this->_content.memoryUsage() + this->_shown.memoryUsage(); }
+
+private:
+  MinuCellGrid _content;
+  MinuCellGrid _shown;
+  MinuGridWriter _writer;
+  uint16_t _fore;
+  uint16_t _back;
+  bool _dirty;
+};
+
+
 /// @brief Most basic unit of the menu system.
 class MinuPageItem
 {
@@ -49,8 +556,7 @@ public:
     // to prevent function calling at random memory addressess
     this->_link = NULL;
     this->_highlightedCallback = NULL;
-    this->_auxTextForeground = MINU_FOREGROUND_COLOUR_DEFAULT;
-    this->_auxTextBackground = MINU_BACKGROUND_COLOUR_DEFAULT;
+    this->_initState(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
   }
 
   /// @brief Class constructor
@@ -70,12 +576,50 @@ public:
     this->_id = id;
     this->_link = link;
     this->_highlightedCallback = hCb;
-    this->_auxTextForeground = auxFore;
-    this->_auxTextBackground = auxBack;
+    this->_initState(auxFore, auxBack);
 
     this->setAuxText(auxText);
     this->setMainText(mainText);
   }
+
+  /// @brief Class copy constructor
+  /// @note  The status and colours are atomic, so they have to be copied explicitly
+  MinuPageItem(const MinuPageItem &other)
+      : _mainText(other._mainText), _auxText(other._auxText), _link(other._link), _id(other._id),
+        _highlightedCallback(other._highlightedCallback)
+  {
+    this->_copyState(other);
+  }
+
+  /// @brief Class move constructor, which takes over the texts of \a other rather than copying them
+  MinuPageItem(MinuPageItem &&other)
+      : _mainText(std::move(other._mainText)), _auxText(std::move(other._auxText)), _link(other._link),
+        _id(other._id), _highlightedCallback(other._highlightedCallback)
+  {
+    this->_copyState(other);
+  }
+
+  MinuPageItem &operator=(MinuPageItem &&other)
+  {
+    this->_mainText = std::move(other._mainText);
+    this->_auxText = std::move(other._auxText);
+    this->_link = other._link;
+    this->_id = other._id;
+    this->_highlightedCallback = other._highlightedCallback;
+    this->_copyState(other);
+    return *this;
+  }
+
+  MinuPageItem &operator=(const MinuPageItem &other)
+  {
+    this->_mainText = other._mainText;
+    this->_auxText = other._auxText;
+    this->_link = other._link;
+    this->_id = other._id;
+    this->_highlightedCallback = other._highlightedCallback;
+    this->_copyState(other);
+    return *this;
+  }
     
   /// @brief    Set the function to be called when the item becomes the highlighted item of the currently active page.
   /// @param cb User-defined callback function.
@@ -89,22 +633,38 @@ public:
       this->_highlightedCallback(this);
   }
 
+  /// @brief Returns the function called when the item becomes highlighted
+  MinuCallbackFunction highlightedCallback(void) const { return this->_highlightedCallback; }
+
   /// @brief Returns the user-defined function associated with the item
   ///        which can be called to perform a task when the item is selected
   MinuCallbackFunction link(void) const { return this->_link; };
 
+  /// @brief Set the user-defined function associated with the item
+  void setLink(MinuCallbackFunction link) { this->_link = link; }
+
   ///@brief Returns the identifier of assigned to the item  unique within a MinuPage
   size_t id(void) const { return _id; };
 
+  /// @brief Set the item's identifier to the key it is reconciled by, and mark it as keyed. See MinuPage::reconcile()
+  void setKey(size_t key)
+  {
+    this->_id = key;
+    this->_status.fetch_or(MINU_STATUS_KEYED, std::memory_order_acq_rel);
+  }
+
+  /// @brief Whether the item's id() is a key, set by setKey() or by MinuPage::reconcile()
+  bool keyed() const { return this->_status.load(std::memory_order_acquire) & MINU_STATUS_KEYED; }
+
   /// @brief Set the main text of the item
   /// @param mainText Text to set.
   /// @note  Setting the \a mainText to NULL clears the current text.
-  void setMainText(const char *mainText) {this->_mainText = (mainText) ? mainText : String();}
+  void setMainText(const char *mainText) {this->_mainText = (mainText) ? mainText : MinuString();}
 
   /// @brief Set the auxiliary text of the item
   /// @param auxText Text to set.
   /// @note  Setting the \a auxText to NULL clears the current text.
-  void setAuxText(const char *auxText){this->_auxText = (auxText) ? auxText : String();}
+  void setAuxText(const char *auxText){this->_auxText = (auxText) ? auxText : MinuString();}
 
   /// @brief Returns the item's main text
   const char* mainText(void)const {return this->_mainText.c_str();}
@@ -124,7 +684,7 @@ public:
   }
 
   /// @brief Returns the length of the item's main text
-  size_t mainTextLength() { return this->_mainText.length();}
+  size_t mainTextLength() const { return this->_mainText.length();}
 
   /// @brief Return the item's auxiliary text
   const char* auxText(void)const {return this->_auxText.c_str();}
@@ -144,28 +704,152 @@ public:
   }
 
   /// @brief Returns the length of the item's auxiliary text
-  size_t auxTextLength() { return this->_auxText.length(); }
+  size_t auxTextLength() const { return this->_auxText.length(); }
 
   /// @brief Set the foreground colour used to print the auxiliary text
-  void setAuxTextForeground(uint16_t fore) { this->_auxTextForeground = fore; }
+  void setAuxTextForeground(uint16_t fore) { this->setStatus(this->status(), fore, this->auxTextBackground()); }
 
   /// @brief Set the background colour used to print the auxiliary text
-  void setAuxTextBackground(uint16_t back) { this->_auxTextBackground = back; }
+  void setAuxTextBackground(uint16_t back) { this->setStatus(this->status(), this->auxTextForeground(), back); }
 
   /// @brief Return the foreground colour used to print the auxiliary text
-  uint16_t auxTextForeground() const { return this->_auxTextForeground; }
+  uint16_t auxTextForeground() const { return this->auxTextColours() & 0xFFFF; }
 
   /// @brief Return the background colour used to print the auxiliary text
-  uint16_t auxTextBackground() const { return this->_auxTextBackground; }
+  uint16_t auxTextBackground() const { return this->auxTextColours() >> 16; }
+
+  /// @brief Return both auxiliary text colours, read together. The foreground is in the lower 16 bits
+  uint32_t auxTextColours() const
+  {
+#ifdef MINU_PALETTE
+    uint32_t word = this->_status.load(std::memory_order_acquire);
+    return ((word >> 8) & 0x0F) | ((word >> 12) & 0x0F) << 16;
+#else
+    return this->_auxColours.load(std::memory_order_acquire);
+#endif
+  }
+
+  /// @brief  Set the item's status and the auxiliary text colours that display it
+  /// @note   Safe to call from any task or interrupt without locking, concurrently with render().
+  ///         A change marks the item as changed until its page is next rendered
+  /// @param  state Application-defined state, e.g. one of MinuItemStatus
+  /// @param  fore  Auxiliary text foreground colour
+  /// @param  back  Auxiliary text background colour
+  /// @return true, if the item was unchanged since it was last rendered and now needs rendering.
+  ///         Further changes before the next render return false, so callers can coalesce render requests
+  bool setStatus(uint8_t state, uint16_t fore, uint16_t back)
+  {
+    state &= ~MINU_STATUS_CHANGED;
+#ifdef MINU_PALETTE
+    // The colours share the status word, so they are compared and updated along with the state
+    uint32_t word = state | _packColours(fore, back);
+    bool coloursChanged = false;
+#else
+    uint32_t word = state;
+    uint32_t colours = _packColours(fore, back);
+    bool coloursChanged = this->_auxColours.exchange(colours, std::memory_order_acq_rel) != colours;
+#endif
+
+    uint32_t previous = this->_status.load(std::memory_order_relaxed);
+    uint32_t next;
+    do
+    {
+      bool changed = coloursChanged || (previous & ~(MINU_STATUS_CHANGED | MINU_STATUS_KEYED)) != word;
+      next = word | (previous & (MINU_STATUS_CHANGED | MINU_STATUS_KEYED)) | ((changed) ? MINU_STATUS_CHANGED : 0);
+    } while (!this->_status.compare_exchange_weak(previous, next, std::memory_order_acq_rel,
+                                                  std::memory_order_relaxed));
+
+    return (next & MINU_STATUS_CHANGED) && !(previous & MINU_STATUS_CHANGED);
+  }
+
+  /// @brief Returns the item's application-defined state
+  uint8_t status() const { return this->_status.load(std::memory_order_acquire) & 0xFF & ~MINU_STATUS_CHANGED; }
+
+  /// @brief Whether the status or colours changed since the item was last rendered
+  bool statusChanged() const { return this->_status.load(std::memory_order_acquire) & MINU_STATUS_CHANGED; }
+
+  /// @brief Clear the changed flag, once the item is about to be rendered
+  void clearStatusChanged(void) { this->_status.fetch_and(~(uint32_t)MINU_STATUS_CHANGED, std::memory_order_acq_rel); }
+
+  /// @brief Returns the heap bytes used by the main and auxiliary texts
+  size_t textMemoryUsage() const { return minuStringHeapBytes(this->_mainText) + minuStringHeapBytes(this->_auxText); }
 
 private:
-  String _mainText;
-  String _auxText;
-  uint16_t _auxTextForeground;
-  uint16_t _auxTextBackground;
+#ifdef MINU_PALETTE
+  /// @brief Pack two palette indices into bits 8 to 15 of the status word
+  static uint32_t _packColours(uint16_t fore, uint16_t back) { return ((fore & 0x0F) | (back & 0x0F) << 4) << 8; }
+#else
+  static uint32_t _packColours(uint16_t fore, uint16_t back) { return fore | ((uint32_t)back << 16); }
+#endif
+
+  void _initState(uint16_t fore, uint16_t back)
+  {
+#ifdef MINU_PALETTE
+    this->_status.store(MINU_STATUS_NONE | _packColours(fore, back));
+#else
+    this->_auxColours.store(_packColours(fore, back));
+    this->_status.store(MINU_STATUS_NONE);
+#endif
+  }
+
+  /// @brief Copy the status and colours of another item, which are atomic and so have to be copied explicitly
+  void _copyState(const MinuPageItem &other)
+  {
+#ifndef MINU_PALETTE
+    this->_auxColours.store(other._auxColours.load(std::memory_order_acquire));
+#endif
+    this->_status.store(other._status.load(std::memory_order_acquire));
+  }
+
+  MinuString _mainText;
+  MinuString _auxText;
   MinuCallbackFunction _link;
   size_t _id;
   MinuCallbackFunction _highlightedCallback;
+  // The colours and status are kept in single 32-bit words, which can be updated atomically on any target.
+  // With MINU_PALETTE, both fit in the status word
+#ifndef MINU_PALETTE
+  std::atomic<uint32_t> _auxColours;
+#endif
+  std::atomic<uint32_t> _status;
+};
+
+/// @brief Describes an item passed to MinuPage::reconcile()
+/// @note  The texts are only read during the call, so they may point into temporary buffers
+struct MinuItemSpec
+{
+  MinuItemSpec(size_t key, MinuCallbackFunction link, const char *mainText, const char *auxText,
+               MinuCallbackFunction hCb = NULL, uint16_t auxFore = MINU_FOREGROUND_COLOUR_DEFAULT,
+               uint16_t auxBack = MINU_BACKGROUND_COLOUR_DEFAULT)
+      : key(key), link(link), mainText(mainText), auxText(auxText), highlightedCallback(hCb), auxFore(auxFore),
+        auxBack(auxBack)
+  {
+  }
+
+  size_t key;   // Identifies the item from one reconciliation to the next, e.g. minuKey(bssid). Becomes its id()
+  MinuCallbackFunction link;
+  const char *mainText;
+  const char *auxText;
+  MinuCallbackFunction highlightedCallback;
+  uint16_t auxFore;
+  uint16_t auxBack;
+};
+
+/// @brief Interface for pages whose items are read on demand, e.g. from a file, rather than held in memory
+/// @note  A page with a source only reads the items it renders or passes to a callback, one at a time.
+///        See minu_catalog.hpp for a source reading items from an indexed file
+class MinuItemSource
+{
+public:
+  virtual ~MinuItemSource() {}
+
+  /// @brief Returns the number of items available
+  virtual size_t itemCount() = 0;
+
+  /// @brief  Read an item
+  /// @param  index Index of the item, less than itemCount()
+  /// @return Pointer to the item, valid until the next item is read, or NULL if it could not be read
+  virtual MinuPageItem *loadItem(size_t index) = 0;
 };
 
 class MinuPage
@@ -188,6 +872,16 @@ public:
     this->_openedCallback = NULL;
     this->_renderedCallback = NULL;
     this->_closedCallback = NULL;
+    this->_dispatcher = NULL;
+    this->_builder = NULL;
+    this->_built = true;
+    this->_closedAt = 0;
+    this->_source = NULL;
+    this->_sortDescending = true;
+    this->_sortLimit = 0;
+    this->_sortedBegin = 0;
+    this->_itemsVersion = 0;
+    this->_nextItemId = 0;
     setTitle(title);
   }
   /// @brief  Set the function to be called when the page becomes the currently active page
@@ -205,13 +899,85 @@ public:
   /// @note   When called, the pointer to this page is passed as the parameter.
   void setClosedCallback(MinuCallbackFunction cb) { this->_closedCallback = cb; }
 
+  /// @brief Set the dispatcher that opened, closed and item highlighted callbacks are passed to
+  /// @param dispatcher Dispatcher to use, or NULL to call the callbacks immediately
+  void setCallbackDispatcher(MinuCallbackDispatcher *dispatcher) { this->_dispatcher = dispatcher; }
+
+  /// @brief  Set the function that adds the page's items, called when the page is opened and has not been built
+  /// @param  cb User-defined callback function, or NULL for a page whose items are added directly
+  /// @note   When called, the pointer to this page is passed as the parameter. The builder may also set the page's
+  ///         callbacks, and the opened callback it sets is called right after it.
+  /// @note   A page with a builder starts out without items, and they may be released while the page is closed
+  void setBuilder(MinuCallbackFunction cb)
+  {
+    this->_builder = cb;
+    this->_built = !cb;
+  }
+
+  /// @brief Read the page's items from a source rather than from the items added to the page
+  /// @param source Source to read from, or NULL to show the added items again
+  /// @note  Sources read items one at a time, so the pointer passed to their link and highlighted callbacks is only
+  ///        valid until the next item is read
+  void setItemSource(MinuItemSource *source)
+  {
+    this->_source = source;
+    this->_itemsVersion++;
+  }
+
+  /// @brief Returns the page's item source, or NULL if it has none
+  MinuItemSource *itemSource() const { return this->_source; }
+
+  /// @brief Whether the page is built by a builder when opened
+  bool lazy() const { return this->_builder != NULL; }
+
+  /// @brief Whether the page's items are present, i.e. the page has no builder or it has been built
+  bool built() const { return this->_built; }
+
+  /// @brief  Call the builder, if the page has one and is not built
+  /// @return true, if the builder was called
+  bool build(void)
+  {
+    if (this->_built)
+      return false;
+
+    this->removeAllItems();
+    this->_built = true;
+    this->_builder(this);
+    if (this->_highlightedIndex < 0 || (size_t)this->_highlightedIndex >= this->getItemCount())
+      this->_highlightedIndex = 0;
+    return true;
+  }
+
+  /// @brief  Free the items of a page that has a builder, to be built again when the page is next opened
+  /// @note   Only call while the page is not the current page
+  /// @return true, if the items were freed
+  bool release(void)
+  {
+    if (!this->_builder || !this->_built)
+      return false;
+
+    std::vector<MinuPageItem>().swap(this->_items);
+    std::vector<int32_t>().swap(this->_sortKeys);
+    this->_sortedBegin = 0;
+    this->_itemsVersion++;
+    this->_nextItemId = 0;
+    this->_built = false;
+    return true;
+  }
+
+  /// @brief Record when the page was closed, in milliseconds of an arbitrary clock, e.g. MinuEventLoop's
+  void setClosedTime(uint32_t ms) { this->_closedAt = ms; }
+
+  /// @brief Returns the time set by setClosedTime()
+  uint32_t closedTime() const { return this->_closedAt; }
+
   /// @brief Set the text to be printed at the top of the page
-  void setTitle(const char *title) {this->_title = title;}
+  void setTitle(const char *title) {this->_title = (title) ? title : MinuString();}
 
   /// @brief Invoke the page opened callback (if one was registered)
   void callOpenedCallback()
   {
-    if (this->_openedCallback)
+    if (this->_openedCallback && !this->_dispatch(this->_openedCallback, -1))
       this->_openedCallback(this);
   }
 
@@ -225,9 +991,16 @@ public:
   /// @brief Invoke the page closed callback (if one was registered)
   void callClosedCallback()
   {
-    if (this->_closedCallback)
+    if (this->_closedCallback && !this->_dispatch(this->_closedCallback, -1))
       this->_closedCallback(this);
   }
+
+  /// @brief Invoke the highlighted callback of the highlighted item (if there is one and it registered a callback)
+  void callHighlightedCallback()
+  {
+    if (this->_highlightedIndex >= 0 && (size_t)this->_highlightedIndex < this->getItemCount())
+      this->_callHighlightedCallback(this->_highlightedIndex);
+  }
   
   ///@brief Uniquely identifies the page within a Minu 
   size_t id(void) const { return _id; };
@@ -235,21 +1008,28 @@ public:
   ///@brief Highlight the item with the next index within a page.
   ///@note  If the current item is the last in the list, the index wraps around to the first item.
   ///@note  If the page has no items, this function has no effect.
-  ssize_t highlightNextItem(void)
+  ssize_t highlightNextItem(void) { return this->moveHighlight(1); }
+
+  ///@brief Move the highlight forwards (\a steps > 0) or backwards (\a steps < 0) by up to \a steps items
+  ///@note  The highlight stops at the last (first) item, and only wraps around once it is moved on from there,
+  ///       so that moving by several items at a time does not skip past the end of the list
+  ///@param notify Whether to call the highlighted callback of the new highlighted item
+  ///@return The index of the new highlighted item, or -1 if the page has no items
+  ssize_t moveHighlight(ssize_t steps, bool notify = true)
   {
-    if(!this->_items.size())
-      return -1;
-    // Increment the current index
-    this->_highlightedIndex++;
-
-    // If the index overflows or becomes greater than the number of items in the page, reset the index
-    if (this->_highlightedIndex < 0 || this->_highlightedIndex >= this->_items.size())
-      this->_highlightedIndex = 0;
-    
-    // Call the highlighted callback for the new highlighted item
-    this->_items[this->_highlightedIndex].callHighlightedCallback();
-    
-    // Return the index of the new highlighted item
+    size_t itemCount = this->getItemCount();
+    if (!itemCount || !steps)
+      return (itemCount) ? this->_highlightedIndex : -1;
+
+    ssize_t last = itemCount - 1;
+    ssize_t index = this->_highlightedIndex + steps;
+    if (steps > 0)
+      this->_highlightedIndex = (this->_highlightedIndex >= last) ? 0 : ((index > last) ? last : index);
+    else
+      this->_highlightedIndex = (this->_highlightedIndex <= 0 || this->_highlightedIndex > last) ? last : ((index < 0) ? 0 : index);
+
+    if (notify)
+      this->_callHighlightedCallback(this->_highlightedIndex);
     return this->_highlightedIndex;
   }
 
@@ -260,34 +1040,20 @@ public:
   bool highlightItem(size_t index)
   {
     // Confirm that the index is valid
-    if (!this->_items.size() || index >= this->_items.size())
+    if (index >= this->getItemCount())
       return false;
 
     this->_highlightedIndex = index;
     
     // Call the highlighted callback for the new highlighted item
-    this->_items[this->_highlightedIndex].callHighlightedCallback();
+    this->_callHighlightedCallback(this->_highlightedIndex);
     return true;
   }
 
   ///@brief Highlight the item with the next index within a page.
   ///@note  If the current item is the first in the list, the index wraps around to the last item.
   ///@note  If the page has no items, this function has no effect.
-  ssize_t highlightPreviousItem(void)
-  {
-    if(!this->_items.size())
-      return -1;
-    // decrement the current index
-    this->_highlightedIndex--;
-
-    // If the index underflows, reset the index to the last item of the page
-    if (this->_highlightedIndex < 0)
-      this->_highlightedIndex = (this->_items.size()) ? (this->_items.size() - 1) :  0;
-
-    // Call the highlighted callback for the new highlighted item
-    this->_items[this->_highlightedIndex].callHighlightedCallback();
-    return this->_highlightedIndex;
-  }
+  ssize_t highlightPreviousItem(void) { return this->moveHighlight(-1); }
 
   /// @brief          Register a new child item  
   /// @param link     User-defined function associated with the item.
@@ -298,19 +1064,85 @@ public:
   /// @param hCb      Function to be called automatically when the item becomes the highlighted member of the parent page
   ssize_t addItem(MinuCallbackFunction link, const char *mainText, const char *auxText, MinuCallbackFunction hCb = NULL)
   {
-    size_t newId = this->_items.size();
-    MinuPageItem itm(newId, link, mainText, auxText, hCb);
+    size_t index = this->_items.size();
+    MinuPageItem itm(this->_nextItemId++, link, mainText, auxText, hCb);
     this->_items.push_back(itm);
+    this->_itemsVersion++;
 
-    if (this->_items.size() == newId + 1)
-      return newId;
+    if (this->_items.size() == index + 1)
+      return index;
 
     return -1;
   }
 
-  /// @brief  Delete a registered child item with the provided index
-  /// @param  index Index of the item to be deleted
-  /// @return true, if the item was successfully deleted
+  /// @brief Set how items added with insertItem() are ordered, and how many of them are kept
+  /// @param descending Whether items with greater keys come first, e.g. the strongest networks when keyed by RSSI
+  /// @param limit      Maximum number of sorted items, or 0 for no limit. When the page is full, an inserted item
+  ///                   pushes out the last one if it sorts before it, and is dropped otherwise
+  /// @note  Only takes effect for items inserted afterwards
+  void setSorting(bool descending, size_t limit = 0)
+  {
+    this->_sortDescending = descending;
+    this->_sortLimit = limit;
+  }
+
+  /// @brief          Register a new child item in sorted position among the other items added with insertItem()
+  /// @note           Sorted items are kept together, starting where the first of them was added, so items added with
+  ///                 addItem() before them (e.g. a status line) or after them (e.g. a back link) stay in place.
+  ///                 Items with equal keys keep the order they were inserted in.
+  /// @note           The highlighted item stays highlighted, and the list does not scroll, as items are inserted
+  ///                 before or after it. If it is pushed out, the last sorted item is highlighted instead.
+  /// @param key      Ordering key of the item, e.g. the RSSI of a network. See setSorting()
+  /// @param link, mainText, auxText, hCb See addItem()
+  /// @param id       Identifier of the item, or -1 to give it the page's next id, as addItem() does
+  /// @return The index of the new item, or -1 if it was dropped because the page is full
+  ssize_t insertItem(int32_t key, MinuCallbackFunction link, const char *mainText, const char *auxText,
+                     MinuCallbackFunction hCb = NULL, ssize_t id = -1)
+  {
+    if (this->_sortKeys.empty())
+      this->_sortedBegin = this->_items.size();
+
+    // Binary search for the first item that sorts after the new one
+    size_t lo = 0, hi = this->_sortKeys.size();
+    while (lo < hi)
+    {
+      size_t mid = (lo + hi) / 2;
+      bool after = (this->_sortDescending) ? (this->_sortKeys[mid] < key) : (this->_sortKeys[mid] > key);
+      if (after)
+        hi = mid;
+      else
+        lo = mid + 1;
+    }
+
+    bool highlighted = this->_highlightedIndex >= 0 && (size_t)this->_highlightedIndex < this->_items.size();
+    if (this->_sortLimit && this->_sortKeys.size() >= this->_sortLimit)
+    {
+      if (lo >= this->_sortLimit)
+        return -1;
+
+      // The last sorted item makes room for the new one. If it was highlighted, the highlight stays on the new last
+      size_t last = this->_sortedBegin + this->_sortKeys.size() - 1;
+      this->_items.erase(this->_items.begin() + last);
+      this->_sortKeys.pop_back();
+      if (highlighted && (size_t)this->_highlightedIndex > last)
+        this->_highlightedIndex--;
+      else if (highlighted && (size_t)this->_highlightedIndex == last)
+        highlighted = false;
+    }
+
+    size_t index = this->_sortedBegin + lo;
+    size_t itemId = (id >= 0) ? (size_t)id : this->_nextItemId++;
+    this->_items.insert(this->_items.begin() + index, MinuPageItem(itemId, link, mainText, auxText, hCb));
+    this->_itemsVersion++;
+    this->_sortKeys.insert(this->_sortKeys.begin() + lo, key);
+    if (highlighted && (size_t)this->_highlightedIndex >= index)
+      this->_highlightedIndex++;
+    return index;
+  }
+
+  /// @brief  Delete a registered child item with the provided index
+  /// @param  index Index of the item to be deleted
+  /// @return true, if the item was successfully deleted
   /// @return false, if the page has no items or the index was invalid
   bool removeItem(size_t index)
   {
@@ -318,11 +1150,128 @@ public:
       return false;
 
     this->_items.erase(this->_items.begin() + index);
+    this->_itemsVersion++;
+
+    // Keep the sorted items' keys in step with their positions
+    if (index < this->_sortedBegin)
+      this->_sortedBegin--;
+    else if (index - this->_sortedBegin < this->_sortKeys.size())
+      this->_sortKeys.erase(this->_sortKeys.begin() + (index - this->_sortedBegin));
     return true;
   }
 
+  /// @brief  Make the page's items match a new list, changing only what differs
+  /// @note   Items are matched by key, taken from their id(). Only keyed items are matched, i.e. those created by an
+  ///         earlier reconciliation or given a key with MinuPageItem::setKey(), so that the ids addItem() numbers
+  ///         its items by never match a key. A matched item keeps its texts, and their storage, unless they changed,
+  ///         and is moved into its new position. Other items are removed, and new ones are created, so refreshing a
+  ///         list that barely changed allocates no texts.
+  /// @note   The highlighted item stays highlighted wherever it moves to. If it was removed, the item now at its
+  ///         position is highlighted and its highlighted callback is called.
+  /// @note   The new items are not sorted. Items inserted with insertItem() afterwards are sorted among themselves
+  /// @note   Takes O(n log n) time for n items. A key given twice matches an existing item with its first spec only
+  /// @param  specs The new list of items, in order
+  /// @param  count Number of items in \a specs
+  /// @return The number of items that were added, removed, moved or changed
+  size_t reconcile(const MinuItemSpec *specs, size_t count)
+  {
+    bool highlighted = this->_highlightedIndex >= 0 && (size_t)this->_highlightedIndex < this->_items.size();
+    size_t changes = 0;
+
+    // The specs' keys are sorted along with their positions, so that each item finds its new position by binary
+    // search. Equal keys sort by position, so an item finds the first spec with its key
+    std::vector<std::pair<size_t, size_t>> keys;
+    keys.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+      keys.push_back(std::make_pair(specs[i].key, i));
+    std::sort(keys.begin(), keys.end());
+
+    // The position of the existing item each spec takes over, or -1. An item that now comes before one it used to
+    // follow counts as moved
+    std::vector<ssize_t> matches(count, -1);
+    size_t lastSpec = 0;
+    for (size_t j = 0; j < this->_items.size(); ++j)
+    {
+      size_t key = this->_items[j].id();
+      auto it = std::lower_bound(keys.begin(), keys.end(), std::make_pair(key, (size_t)0));
+      if (!this->_items[j].keyed() || it == keys.end() || it->first != key || matches[it->second] >= 0)
+      {
+        changes++;
+        continue;
+      }
+      matches[it->second] = j;
+      changes += it->second < lastSpec;
+      lastSpec = it->second;
+    }
+
+    std::vector<MinuPageItem> items;
+    items.reserve(count);
+    ssize_t highlightedIndex = -1;
+    bool reordered = this->_items.size() != count;
+    for (size_t i = 0; i < count; ++i)
+    {
+      const MinuItemSpec &spec = specs[i];
+      reordered |= matches[i] != (ssize_t)i;
+      if (matches[i] < 0)
+      {
+        items.push_back(MinuPageItem(spec.key, spec.link, spec.mainText, spec.auxText, spec.highlightedCallback,
+                                     spec.auxFore, spec.auxBack));
+        items.back().setKey(spec.key);
+        changes++;
+        continue;
+      }
+      if (highlighted && matches[i] == this->_highlightedIndex)
+        highlightedIndex = i;
+      items.push_back(std::move(this->_items[matches[i]]));
+
+      MinuPageItem &item = items.back();
+      bool changed = false;
+      if (strcmp(item.mainText(), (spec.mainText) ? spec.mainText : ""))
+      {
+        item.setMainText(spec.mainText);
+        changed = true;
+      }
+      if (strcmp(item.auxText(), (spec.auxText) ? spec.auxText : ""))
+      {
+        item.setAuxText(spec.auxText);
+        changed = true;
+      }
+      if (item.auxTextForeground() != spec.auxFore || item.auxTextBackground() != spec.auxBack)
+      {
+        item.setStatus(item.status(), spec.auxFore, spec.auxBack);
+        changed = true;
+      }
+      item.setLink(spec.link);
+      item.setHighlightedCallback(spec.highlightedCallback);
+      changes += changed;
+    }
+    this->_items.swap(items);
+    this->_sortKeys.clear();
+    this->_sortedBegin = 0;
+    this->_itemsVersion += reordered;
+
+    if (!highlighted)
+      return changes;
+    if (highlightedIndex >= 0)
+    {
+      this->_highlightedIndex = highlightedIndex;
+      return changes;
+    }
+    if ((size_t)this->_highlightedIndex >= this->_items.size())
+      this->_highlightedIndex = (this->_items.size()) ? this->_items.size() - 1 : 0;
+    this->callHighlightedCallback();
+    return changes;
+  }
+
   /// @brief Delete all of the page's registered child items
-  void removeAllItems(void) {this->_items.clear();}
+  void removeAllItems(void)
+  {
+    this->_items.clear();
+    this->_sortKeys.clear();
+    this->_sortedBegin = 0;
+    this->_itemsVersion++;
+    this->_nextItemId = 0;
+  }
 
   /// @brief Returns the item with the given index
   /// @param index Index of the item 
@@ -330,24 +1279,33 @@ public:
   /// @return Empty item, if the index is invalid
   MinuPageItem getItem(size_t index)
   {
-    if (index >= this->_items.size())
-      return MinuPageItem();
-
-    return this->_items[index];
+    const MinuPageItem *item = this->_item(index);
+    return (item) ? *item : MinuPageItem();
   }
 
-  /// @brief Return the number of the page's registered items
-  size_t getItemCount() { return this->_items.size(); }
+  /// @brief  Returns a pointer to the item with the given index, which is read if the page has a source
+  /// @return NULL, if the index is invalid or the item could not be read
+  MinuPageItem *item(size_t index) { return const_cast<MinuPageItem *>(this->_item(index)); }
+
+  /// @brief Return the number of the page's registered items, or of the items of its source
+  size_t getItemCount() { return (this->_source) ? this->_source->itemCount() : this->_items.size(); }
+
+  /// @brief Returns a counter incremented whenever items are added, removed or reordered, after which an item index
+  ///        may refer to another item
+  /// @note  Changes made directly to the vector returned by items(), or to the page's source, are not counted
+  uint32_t itemsVersion() const { return this->_itemsVersion; }
 
   /// @brief Return a reference the page's currently highlighted child item
+  /// @note  A page without items has no highlighted item, and returns a shared empty item instead
   const MinuPageItem &highlightedItem(void) const
   {
-    if (_highlightedIndex >= 0 && _highlightedIndex < this->_items.size())
-      return this->_items[_highlightedIndex];
-
-    return MinuPageItem();
+    static const MinuPageItem empty;
+    const MinuPageItem *item = (_highlightedIndex >= 0) ? this->_item(_highlightedIndex) : NULL;
+    return (item) ? *item : empty;
   }
   /// @brief Returns a reference to the vector of the page's child items
+  /// @note  The items of a source are not in the vector
+  /// @note  Add and remove items through the page rather than the vector, so that sorted items stay sorted
   std::vector<MinuPageItem> &items() { return this->_items; }
   
   /// @brief Returns the page's title
@@ -357,60 +1315,422 @@ public:
   /// @return 
   bool infoMode() const { return this->_infoMode; }
 
+  /// @brief Returns the RAM used by the page, its items and their texts
+  MinuMemoryUsage memoryUsage() const
+  {
+    MinuMemoryUsage usage;
+    usage.pages = sizeof(MinuPage);
+    usage.items = this->_items.capacity() * sizeof(MinuPageItem) + this->_sortKeys.capacity() * sizeof(int32_t);
+    usage.text = minuStringHeapBytes(this->_title);
+    for (size_t i = 0; i < this->_items.size(); ++i)
+      usage.text += this->_items[i].textMemoryUsage();
+    return usage;
+  }
+
 private:
+  /// @brief Pass a callback to the dispatcher, if one was set
+  /// @return true, if the dispatcher accepted the call
+  bool _dispatch(MinuCallbackFunction cb, ssize_t itemIndex)
+  {
+    return this->_dispatcher && this->_dispatcher->dispatch(cb, this, itemIndex);
+  }
+
+  /// @brief Returns a pointer to an added item, or to an item read from the source
+  const MinuPageItem *_item(size_t index) const
+  {
+    if (!this->_source)
+      return (index < this->_items.size()) ? &this->_items[index] : NULL;
+    return (index < this->_source->itemCount()) ? this->_source->loadItem(index) : NULL;
+  }
+
+  /// @brief Invoke the highlighted callback of the item with the given index, through the dispatcher if one was set
+  void _callHighlightedCallback(size_t index)
+  {
+    MinuPageItem *item = this->item(index);
+    MinuCallbackFunction cb = (item) ? item->highlightedCallback() : NULL;
+    if (cb && !this->_dispatch(cb, index))
+      cb(item);
+  }
+
   bool _infoMode;
   size_t _id;
-  String _title;
+  MinuString _title;
   std::vector<MinuPageItem> _items;
   ssize_t _highlightedIndex;
   MinuCallbackFunction _openedCallback;
   MinuCallbackFunction _renderedCallback;
   MinuCallbackFunction _closedCallback;
+  MinuCallbackDispatcher *_dispatcher;
+  MinuCallbackFunction _builder;
+  bool _built;
+  uint32_t _closedAt;
+  MinuItemSource *_source;
+  std::vector<int32_t> _sortKeys;   // Keys of the items added with insertItem(), in the order of the items
+  size_t _sortedBegin;              // Index of the first of those items
+  bool _sortDescending;
+  size_t _sortLimit;
+  uint32_t _itemsVersion;           // See itemsVersion()
+  size_t _nextItemId;               // Id given to the next item added, which only grows until all items are removed
 };
 
-class Minu
+/// @brief A batch of changes to a page, applied all at once by the task that renders the menu.
+/// @note  Changing a page's items from one task while another renders it is unsafe, since render() may be reading an
+///        item that is being changed or an item vector that is being reallocated. Instead, other tasks record their
+///        changes in a transaction and pass it to MinuBasic::commit(). Committing never blocks, and committed
+///        transactions are applied at the start of the next render, so a render never sees half of a batch.
+/// @note  Item indexes refer to the page as it is when the transaction is applied, after any earlier changes in
+///        the same transaction. Changes to items that do not exist are ignored.
+class MinuTransaction
+{
+
+public:
+  /// @brief Class constructor
+  /// @param pageId Id of the page to change
+  MinuTransaction(size_t pageId) { this->_pageId = pageId; }
+
+  /// @brief Returns the id of the page the transaction changes
+  size_t pageId() const { return this->_pageId; }
+
+  /// @brief Whether the transaction has no changes
+  bool empty() const { return this->_changes.empty(); }
+
+  /// @brief Register a new child item. See MinuPage::addItem()
+  void addItem(MinuCallbackFunction link, const char *mainText, const char *auxText, MinuCallbackFunction hCb = NULL)
+  {
+    Change change = this->_change(ADD_ITEM, 0);
+    change.link = link;
+    change.highlightedCallback = hCb;
+    change.text = (mainText) ? mainText : MinuString();
+    change.auxText = (auxText) ? auxText : MinuString();
+    this->_changes.push_back(change);
+  }
+
+  /// @brief Register a new child item in sorted position. See MinuPage::insertItem()
+  void insertItem(int32_t key, MinuCallbackFunction link, const char *mainText, const char *auxText,
+                  MinuCallbackFunction hCb = NULL, ssize_t id = -1)
+  {
+    // The id is carried in the index, which an insertion has no other use for
+    Change change = this->_change(INSERT_ITEM, (size_t)id);
+    change.key = key;
+    change.link = link;
+    change.highlightedCallback = hCb;
+    change.text = (mainText) ? mainText : MinuString();
+    change.auxText = (auxText) ? auxText : MinuString();
+    this->_changes.push_back(change);
+  }
+
+  /// @brief Delete the item with the given index
+  void removeItem(size_t index) { this->_changes.push_back(this->_change(REMOVE_ITEM, index)); }
+
+  /// @brief Delete all of the page's items
+  void removeAllItems(void) { this->_changes.push_back(this->_change(REMOVE_ALL_ITEMS, 0)); }
+
+  /// @brief Set the page's title
+  void setTitle(const char *title)
+  {
+    Change change = this->_change(SET_TITLE, 0);
+    change.text = (title) ? title : MinuString();
+    this->_changes.push_back(change);
+  }
+
+  /// @brief Set the main text of the item with the given index
+  void setMainText(size_t index, const char *mainText)
+  {
+    Change change = this->_change(SET_MAIN_TEXT, index);
+    change.text = (mainText) ? mainText : MinuString();
+    this->_changes.push_back(change);
+  }
+
+  /// @brief Set the auxiliary text of the item with the given index
+  void setAuxText(size_t index, const char *auxText)
+  {
+    Change change = this->_change(SET_AUX_TEXT, index);
+    change.text = (auxText) ? auxText : MinuString();
+    this->_changes.push_back(change);
+  }
+
+  /// @brief Set the foreground colour of the auxiliary text of the item with the given index
+  void setAuxTextForeground(size_t index, uint16_t fore)
+  {
+    Change change = this->_change(SET_AUX_FOREGROUND, index);
+    change.colour = fore;
+    this->_changes.push_back(change);
+  }
+
+  /// @brief Set the background colour of the auxiliary text of the item with the given index
+  void setAuxTextBackground(size_t index, uint16_t back)
+  {
+    Change change = this->_change(SET_AUX_BACKGROUND, index);
+    change.colour = back;
+    this->_changes.push_back(change);
+  }
+
+  /// @brief Apply the changes to a page
+  /// @note  Only call from the task that renders the menu
+  void applyTo(MinuPage &page) const
+  {
+    for (size_t i = 0; i < this->_changes.size(); ++i)
+    {
+      const Change &change = this->_changes[i];
+      if (change.type == ADD_ITEM)
+      {
+        page.addItem(change.link, change.text.c_str(), change.auxText.c_str(), change.highlightedCallback);
+        continue;
+      }
+      if (change.type == INSERT_ITEM)
+      {
+        page.insertItem(change.key, change.link, change.text.c_str(), change.auxText.c_str(),
+                        change.highlightedCallback, (ssize_t)change.index);
+        continue;
+      }
+      if (change.type == REMOVE_ALL_ITEMS)
+      {
+        page.removeAllItems();
+        continue;
+      }
+      if (change.type == SET_TITLE)
+      {
+        page.setTitle(change.text.c_str());
+        continue;
+      }
+
+      if (change.index >= page.items().size())
+        continue;
+      MinuPageItem &item = page.items()[change.index];
+      if (change.type == REMOVE_ITEM)
+        page.removeItem(change.index);
+      else if (change.type == SET_MAIN_TEXT)
+        item.setMainText(change.text.c_str());
+      else if (change.type == SET_AUX_TEXT)
+        item.setAuxText(change.text.c_str());
+      else if (change.type == SET_AUX_FOREGROUND)
+        item.setAuxTextForeground(change.colour);
+      else if (change.type == SET_AUX_BACKGROUND)
+        item.setAuxTextBackground(change.colour);
+    }
+  }
+
+private:
+  enum ChangeType
+  {
+    ADD_ITEM,
+    INSERT_ITEM,
+    REMOVE_ITEM,
+    REMOVE_ALL_ITEMS,
+    SET_TITLE,
+    SET_MAIN_TEXT,
+    SET_AUX_TEXT,
+    SET_AUX_FOREGROUND,
+    SET_AUX_BACKGROUND,
+  };
+
+  struct Change
+  {
+    ChangeType type;
+    size_t index;
+    MinuString text;
+    MinuString auxText;
+    uint16_t colour;
+    int32_t key;
+    MinuCallbackFunction link;
+    MinuCallbackFunction highlightedCallback;
+  };
+
+  Change _change(ChangeType type, size_t index)
+  {
+    Change change;
+    change.type = type;
+    change.index = index;
+    change.colour = 0;
+    change.key = 0;
+    change.link = NULL;
+    change.highlightedCallback = NULL;
+    return change;
+  }
+
+  size_t _pageId;
+  std::vector<Change> _changes;
+};
+
+/// @brief Print backend that forwards text to a pair of user-defined print functions.
+/// @note  This is the backend used by Minu. Any class providing the same print(), printInverted() and flush()
+///        members can be used with MinuBasic instead.
+class MinuFunctionBackend
+{
+
+public:
+  /// @brief Class constructor
+  /// @param print         Basic function used to print text to the screen
+  /// @param printInverted Basic function used to print inverted colour text to the screen, used for highlighted items
+  MinuFunctionBackend(MinuPrintFunction print = NULL, MinuPrintFunction printInverted = NULL)
+  {
+    this->_print = print;
+    this->_printInverted = printInverted;
+    this->_moveCursor = NULL;
+  }
+
+  void setPrintFunctions(MinuPrintFunction print, MinuPrintFunction printInverted)
+  {
+    if(print)
+      this->_print = print;
+    
+    if(printInverted)
+      this->_printInverted = printInverted;
+  }
+
+  void print(const char *msg, uint16_t len, uint16_t fore, uint16_t back)
+  {
+    if (this->_print)
+      this->_print(msg, len, this->_resolve(fore), this->_resolve(back));
+  }
+
+  void printInverted(const char *msg, uint16_t len, uint16_t fore, uint16_t back)
+  {
+    if (this->_printInverted)
+      this->_printInverted(msg, len, this->_resolve(fore), this->_resolve(back));
+  }
+
+#ifdef MINU_PALETTE
+  /// @brief Returns the palette through which colours are resolved to RGB565 before being passed to the print
+  ///        functions
+  MinuPalette &palette() { return this->_palette; }
+#endif
+
+  /// @brief Set the function used to move the print position, which allows parts of a page to be updated in place
+  void setCursorFunction(MinuCursorFunction moveCursor) { this->_moveCursor = moveCursor; }
+
+  /// @brief Called before the first fragment of a frame is printed
+  void begin(bool /*partial*/) {}
+
+  /// @brief  Move the print position to the given character cell
+  /// @return false, if no cursor function was set
+  bool moveTo(uint16_t col, uint16_t row)
+  {
+    if (!this->_moveCursor)
+      return false;
+    this->_moveCursor(col, row);
+    return true;
+  }
+
+  /// @brief Called once a frame has been completely printed
+  void flush(void) {}
+
+private:
+  uint16_t _resolve(uint16_t colour) const
+  {
+#ifdef MINU_PALETTE
+    return this->_palette.colour(colour);
+#else
+    return colour;
+#endif
+  }
+
+  MinuPrintFunction _print;
+  MinuPrintFunction _printInverted;
+  MinuCursorFunction _moveCursor;
+#ifdef MINU_PALETTE
+  MinuPalette _palette;
+#endif
+};
+
+/// @brief Menu whose output is sent to a compile-time selected print backend.
+/// @note  \a Backend must provide the following members, where the argument types need only be convertible:
+///        - void print(const char *msg, uint16_t len, uint16_t fore, uint16_t back)
+///        - void printInverted(const char *msg, uint16_t len, uint16_t fore, uint16_t back)
+///        - void begin(bool partial), called before the first fragment of each frame. A partial frame updates
+///          cells of the previous frame in place, and every fragment of it is preceded by a call to moveTo()
+///        - bool moveTo(uint16_t col, uint16_t row), returning false if the backend cannot move the print position
+///        - void flush(void), called after the last fragment of each frame
+///        The backend is held by value, so it may keep its own state and its calls can be inlined.
+template <class Backend>
+class MinuBasic
 {
 
 public:
   /// @brief Class condtructor
-  /// @param print_txt          Basic used to print text to the screen
-  /// @param print_txt_inverted Basic used to print inverted colour text to the screen, used for highlighted items
+  /// @param backend            Backend used to print text to the screen
   /// @param mainTextLen        Length of the main text section of a MinuPageItem
   /// @param auxTextLen         Length of the auxiliary text section of a MinuPageItem
-  Minu(MinuPrintFunction print_txt, MinuPrintFunction print_txt_inverted, uint8_t mainTextLen, uint8_t auxTextLen)
+  MinuBasic(const Backend &backend, uint16_t mainTextLen, uint16_t auxTextLen) : _backend(backend)
   {
-    this->_print_txt = print_txt;
-    this->_print_txt_inverted = print_txt_inverted;
     this->_mainTextLen = (mainTextLen) ? mainTextLen : MINU_MAIN_TEXT_LEN_DEFAULT;
 
     this->_auxTextLen = (auxTextLen) ? auxTextLen : MINU_AUX_TEXT_LEN_DEFAULT;
     this->_currentPage = 0;
     this->_rendered = true;
+    this->_observer = NULL;
+    this->_dispatcher = NULL;
+    this->_canvasRow = 0;
+    this->_committed.store(NULL);
+    this->_frameOpen = false;
+    this->_printedBytes = 0;
   }
 
-  Minu()
+  MinuBasic()
   {
     this->_mainTextLen = MINU_MAIN_TEXT_LEN_DEFAULT;
     this->_auxTextLen = MINU_AUX_TEXT_LEN_DEFAULT;
     this->_currentPage = 0;
     this->_rendered = true;
+    this->_observer = NULL;
+    this->_dispatcher = NULL;
+    this->_canvasRow = 0;
+    this->_committed.store(NULL);
+    this->_frameOpen = false;
+    this->_printedBytes = 0;
   }
 
-  void setPrintFunctions(MinuPrintFunction print, MinuPrintFunction printInverted)
+  /// @brief Class destructor, which deletes the pages. Transactions committed but not yet applied are discarded
+  ~MinuBasic()
   {
-    if(print)
-      this->_print_txt = print;
-    
-    if(printInverted)
-      this->_print_txt_inverted = printInverted;
+    for (size_t i = 0; i < this->_pages.size(); ++i)
+      delete this->_pages[i];
+
+    Committed *node = this->_committed.exchange(NULL, std::memory_order_acquire);
+    while (node)
+    {
+      Committed *next = node->next;
+      delete node;
+      node = next;
+    }
   }
 
-  void setTextLength(uint8_t mainTextLen, uint8_t auxTextLen)
+  MinuBasic(const MinuBasic &) = delete;
+  MinuBasic &operator=(const MinuBasic &) = delete;
+
+  /// @brief Returns a reference to the print backend
+  Backend &backend() { return this->_backend; }
+
+  /// @brief Set an observer that receives a copy of every fragment printed during render()
+  /// @param observer Observer to notify, or NULL to stop notifying
+  void setRenderObserver(MinuRenderObserver *observer) { this->_observer = observer; }
+
+  /// @brief Defer the opened, closed and item highlighted callbacks of every page to a dispatcher
+  /// @param dispatcher Dispatcher to use, or NULL to call the callbacks immediately
+  /// @note  This applies to pages added later as well
+  void setCallbackDispatcher(MinuCallbackDispatcher *dispatcher)
+  {
+    this->_dispatcher = dispatcher;
+    for (size_t i = 0; i < this->_pages.size(); ++i)
+      this->_pages[i]->setCallbackDispatcher(dispatcher);
+  }
+
+  /// @brief Returns the canvas drawn below the title of info-mode pages
+  /// @note  The canvas is cleared whenever the current page changes, before the new page's opened callback is called
+  MinuTextCanvas &canvas() { return this->_canvas; }
+
+  void setTextLength(uint16_t mainTextLen, uint16_t auxTextLen)
   {
     this->_mainTextLen = (mainTextLen) ? mainTextLen : MINU_MAIN_TEXT_LEN_DEFAULT;
     this->_auxTextLen = (auxTextLen) ? auxTextLen : MINU_AUX_TEXT_LEN_DEFAULT;
   }
 
+  /// @brief Returns the length of the main text section of an item
+  uint16_t mainTextLength() const { return this->_mainTextLen; }
+
+  /// @brief Returns the length of the auxiliary text section of an item
+  uint16_t auxTextLength() const { return this->_auxTextLen; }
+
   /// @brief Register a new page to the Minu
   /// @param title Title of the new page
   /// @return Id assigned to the page
@@ -418,6 +1738,21 @@ public:
   {
     size_t id = this->_pages.size();
     this->_pages.push_back(new MinuPage(title, id));
+    this->_pages.back()->setCallbackDispatcher(this->_dispatcher);
+    return id;
+  }
+
+  /// @brief Register a new page whose items are only added once it is first opened
+  /// @param title    Title of the new page
+  /// @param build    Function that adds the page's items and sets its callbacks. See MinuPage::setBuilder()
+  /// @param infoMode Whether to skip the printing of child items when rendering the page
+  /// @return Id assigned to the page
+  ssize_t addLazyPage(const char *title, MinuCallbackFunction build, bool infoMode = false)
+  {
+    size_t id = this->_pages.size();
+    this->_pages.push_back(new MinuPage(title, id, infoMode));
+    this->_pages.back()->setBuilder(build);
+    this->_pages.back()->setCallbackDispatcher(this->_dispatcher);
     return id;
   }
 
@@ -427,6 +1762,7 @@ public:
     size_t id = this->_pages.size();
 
     this->_pages.push_back(new MinuPage(page));
+    this->_pages.back()->setCallbackDispatcher(this->_dispatcher);
     return id;
   }
 
@@ -455,10 +1791,80 @@ public:
       this->_pages[this->_currentPage]->callClosedCallback();
 
     this->_currentPage = id;
+    this->_canvas.clear();
+    this->_pages[this->_currentPage]->build();
     this->_pages[this->_currentPage]->callOpenedCallback();
     this->_rendered = false;
     return true;
   }
+  /// @brief  Free the items of closed pages that have a builder, e.g. when memory runs low
+  /// @param  now    Current time, on the clock used for MinuPage::setClosedTime()
+  /// @param  idleMs Only free pages closed at least this long ago
+  /// @return Number of pages freed
+  size_t releasePages(uint32_t now = 0, uint32_t idleMs = 0)
+  {
+    size_t count = 0;
+    for (size_t i = 0; i < this->_pages.size(); ++i)
+    {
+      MinuPage *page = this->_pages[i];
+      if ((ssize_t)i != this->_currentPage && page->built() && now - page->closedTime() >= idleMs)
+        count += page->release();
+    }
+    return count;
+  }
+
+  /// @brief  Publish a transaction, to be applied at the start of the next render
+  /// @note   May be called from any task. The caller must still arrange for the menu to be rendered,
+  ///         e.g. with MinuEventLoop::commit()
+  /// @return false, if the transaction has no changes
+  bool commit(const MinuTransaction &transaction)
+  {
+    if (transaction.empty())
+      return false;
+
+    // Committed transactions form a lock-free stack, which the rendering task takes in one go
+    Committed *node = new Committed(transaction);
+    node->next = this->_committed.load(std::memory_order_relaxed);
+    while (!this->_committed.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                                   std::memory_order_relaxed))
+      ;
+    return true;
+  }
+
+  /// @brief  Apply the committed transactions, in the order they were committed
+  /// @note   Called by render(). Only call from the task that renders the menu
+  /// @return Number of transactions applied
+  size_t applyTransactions(void)
+  {
+    Committed *node = this->_committed.exchange(NULL, std::memory_order_acquire);
+    if (!node)
+      return 0;
+
+    // The stack holds the most recent transaction first
+    Committed *ordered = NULL;
+    while (node)
+    {
+      Committed *next = node->next;
+      node->next = ordered;
+      ordered = node;
+      node = next;
+    }
+
+    size_t count = 0;
+    while (ordered)
+    {
+      Committed *next = ordered->next;
+      // A page that is not built is built from scratch when it is opened, so there is nothing to change
+      size_t pageId = ordered->transaction.pageId();
+      if (pageId < this->_pages.size() && this->_pages[pageId]->built())
+        ordered->transaction.applyTo(*this->_pages[pageId]);
+      delete ordered;
+      ordered = next;
+      count++;
+    }
+    return count;
+  }
+
   /// @brief Returns a pointer to the current page
   /// @return Valid pointer, on success
   /// @return NULL, on fail
@@ -477,121 +1883,418 @@ public:
 
   /// @brief Return the vector of the menu's child items
   const std::vector<MinuPage *> pages() const { return this->_pages; }
+
+  /// @brief Returns the RAM used by the menu, summed over all of its pages
+  /// @note  Use MinuPage::memoryUsage() on the entries of pages() to find which pages dominate.
+  ///        The scratch figure is the buffer render() prints canvas runs and title padding from; the full depth of
+  ///        the stack used by render() can be measured with MinuStackProbe (minu_stack.hpp)
+  MinuMemoryUsage memoryUsage() const
+  {
+    MinuMemoryUsage usage;
+    usage.pages = this->_pages.capacity() * sizeof(MinuPage *);
+    for (size_t i = 0; i < this->_pages.size(); ++i)
+      usage += this->_pages[i]->memoryUsage();
+    usage.caches = this->_canvas.memoryUsage();
+    usage.scratch = MINU_PRINT_BUFF_LEN;
+    return usage;
+  }
   
   /// @brief Whether or not the menu has been rendered after the selected page changed
   bool rendered()const {return this->_rendered;}
 
+  /// @brief Whether the status of any of the current page's items changed since the page was last rendered
+  bool statusChanged() const
+  {
+    MinuPage *page = this->currentPage();
+    if (!page)
+      return false;
+    for (size_t i = 0; i < page->items().size(); ++i)
+      if (page->items()[i].statusChanged())
+        return true;
+    return false;
+  }
+
   /// @brief Create a text-based graphical representation of the current page
   /// @param count Maximum number of items to print, one item per line
-  void render(uint8_t count)
+  void render(uint16_t count)
   {
-    // Check that the menu has registered child pages, and that the argument is valid
-    if (!this->_pages.size() || this->_currentPage >= this->_pages.size() || !count)
+    if (this->_frameOpen)
+      this->_abandonFrame();
+    if (!this->_beginFrame(count))
       return;
+    while (this->_renderNextRow())
+      ;
+    this->_finishFrame();
+  }
 
-    ssize_t highlightedIndex = this->_pages[this->_currentPage]->highlightedIndex();
-    size_t itemCount = this->_pages[this->_currentPage]->getItemCount();
-
-    char printBuff[256];
-    memset(printBuff, 0, sizeof(printBuff));
-
-    // The title text is padded with underscores(_) on either side so we distribute the padding equally on both sides.
-    // If the number of underscores is odd, the extra one is post-fixed.
-    const uint8_t pageWidth = this->_mainTextLen + this->_auxTextLen;
-    uint8_t titleLen = (this->_pages[this->_currentPage]->title()) ? strlen(this->_pages[this->_currentPage]->title()) : 0;
-    uint8_t padding = (pageWidth > titleLen) ? (pageWidth - titleLen) : 1;
-    uint8_t paddingLeft = padding / 2;
-    uint8_t paddingRight = (padding != 1) ? (padding / 2) + (padding % 2) : 0;
-    
-    if((titleLen + paddingLeft + paddingRight) > sizeof(printBuff))
-      titleLen = sizeof(printBuff) - (paddingLeft + paddingRight);
-    if (this->_pages[this->_currentPage]->title() && titleLen)
+  /// @brief  Render part of a frame, continuing the frame started by an earlier call where it stopped
+  /// @note   The title, the canvas of info pages and the highlighted item are printed first, so they appear as soon
+  ///         as possible, and the other items follow one row at a time. The display must not be cleared between the
+  ///         calls that make up a frame.
+  /// @note   A new frame is started whenever the rest of the current one would no longer match what it started, see
+  ///         resumable(). Texts and statuses of items not printed yet are read as they are printed, while changes
+  ///         to items already printed are left to the next frame, e.g. by requesting a render.
+  /// @param  count    Maximum number of items to print, as for render(). Only used when a new frame is started
+  /// @param  maxBytes Number of characters after which to stop, or 0 for no limit
+  /// @param  expired  Function returning true once the time available for rendering is used up, or NULL.
+  ///                  It is checked after each row, and at least one row is printed per call
+  /// @param  arg      Argument passed to \a expired
+  /// @return true, if the frame is complete
+  bool renderPart(uint16_t count, size_t maxBytes = 0, MinuBudgetFunction expired = NULL, void *arg = NULL)
+  {
+    size_t printed = this->_printedBytes;
+    if (!this->resumable())
     {
-      // Prefix padding
-      while (paddingLeft--)
-        sprintf(printBuff + strlen(printBuff), MINU_TITLE_PADDING_DEFAULT);
-
-      // Concatenate title
-      if(titleLen)
-        strncpy(printBuff + strlen(printBuff), this->_pages[this->_currentPage]->title(), titleLen);
-      
-      // Postfix padding
-      while (paddingRight--)
-        sprintf(printBuff + strlen(printBuff), MINU_TITLE_PADDING_DEFAULT);
-
-      // Append newline characters
-      strcpy(printBuff + strlen(printBuff), "\n\n");
-
-      // Print to screen
-      this->_print_txt(printBuff, strlen(printBuff), MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+      if (this->_frameOpen)
+        this->_abandonFrame();
+      this->_rendered = false;
+      if (!this->_beginFrame(count))
+        return true;
+      this->_frameOpen = true;
     }
 
-    // Here we print the page's items
-    // The highlighted item is always the first to be rendered so that changing the highlighted index creates a scrolling effect
-    for (auto it = highlightedIndex; it < itemCount; ++it)
+    bool more;
+    do
+      more = this->_renderNextRow();
+    while (more && !(maxBytes && this->_printedBytes - printed >= maxBytes) && !(expired && expired(arg)));
+    if (more)
+      return false;
+
+    this->_frameOpen = false;
+    this->_finishFrame();
+    return true;
+  }
+
+  /// @brief Whether a frame started by renderPart() is in progress
+  bool frameInProgress() const { return this->_frameOpen; }
+
+  /// @brief Whether the next call to renderPart() continues the frame in progress, rather than starting a new one
+  /// @note  A frame can only be continued while the current page, its highlighted item and its number of items are
+  ///        those it started with, and no changes were committed since, since all rows move otherwise
+  bool resumable()
+  {
+    MinuPage *page = this->currentPage();
+    return this->_frameOpen && page && this->_currentPage == this->_framePage &&
+           page->highlightedIndex() == this->_frameHighlight && page->getItemCount() == this->_frameItemCount &&
+           !this->_committed.load(std::memory_order_acquire);
+  }
+
+  /// @brief  Print the cells of the canvas that changed since the current page was last rendered
+  /// @note   Only the canvas is printed, so the display must not be cleared beforehand
+  /// @return true, if the display is up to date
+  /// @return false, if the whole page needs to be rendered instead, e.g. because the backend cannot move its
+  ///         print position or the current page has not been rendered yet
+  bool renderCanvas(void)
+  {
+    MinuPage *page = this->currentPage();
+    if (!this->_rendered)
+      return false;
+    // Only info pages show the canvas
+    if (!page || !page->infoMode() || !this->_canvas.dirty())
+      return true;
+
+    const MinuCellGrid &content = this->_canvas.content();
+    const MinuCellGrid &shown = this->_canvas.shown();
+    bool started = false;
+    for (uint16_t r = 0; r < content.rows(); ++r)
     {
-      // Don't print items if the page has the infoMode flag set
-      if (this->_pages[this->_currentPage]->infoMode())
-        break;
-      
-      // If the current index is the index of page's highlighted item, print it inverted
-      if (it == highlightedIndex)
+      const MinuCell *next = content.row(r);
+      const MinuCell *prev = shown.row(r);
+      uint16_t c = 0;
+      while (c < content.cols())
       {
-        // If the item has no main text, skip it
-        if (!this->_pages[this->_currentPage]->getItem(it).getMainText(printBuff, sizeof(printBuff)))
+        if (next[c] == prev[c])
+        {
+          c++;
           continue;
+        }
 
-        this->_print_txt_inverted(printBuff, (this->_pages[this->_currentPage]->getItem(it).auxTextLength()) ? (this->_mainTextLen) : pageWidth, MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+        uint16_t begin = c;
+        while (c < content.cols() && next[c] != prev[c])
+          c++;
 
-        // If the item has auxiliary text, print it in custom colour.
-        // For proper presentation, an item's auxiliary text is not highlighted. Only the main text is highlighted
-        if (this->_pages[this->_currentPage]->getItem(it).getAuxText(printBuff, sizeof(printBuff)))
+        // The frame is only started once there is something to print
+        if (!started)
         {
-          this->_print_txt(MINU_ITEM_TEXT_SEPARATOR_DEFAULT, strlen(MINU_ITEM_TEXT_SEPARATOR_DEFAULT), MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
-          this->_print_txt(printBuff, this->_pages[this->_currentPage]->getItem(it).auxTextLength(),
-                    this->_pages[this->_currentPage]->getItem(it).auxTextForeground(),
-                    this->_pages[this->_currentPage]->getItem(it).auxTextBackground());
+          this->_backend.begin(true);
+          if (this->_observer)
+            this->_observer->frameStarted(this->_currentPage, page->highlightedIndex(), true);
+          started = true;
         }
 
-        this->_print_txt_inverted("\n", strlen("\n"), MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+        if (!this->_backend.moveTo(begin, this->_canvasRow + r))
+        {
+          this->_backend.flush();
+          if (this->_observer)
+            this->_observer->frameFinished();
+          this->_rendered = false;
+          return false;
+        }
+        if (this->_observer)
+          this->_observer->cursorMoved(begin, this->_canvasRow + r);
+        this->_printCells(next + begin, c - begin);
       }
-      else
+    }
+
+    if (started)
+    {
+      this->_backend.flush();
+      if (this->_observer)
+        this->_observer->frameFinished();
+    }
+    this->_canvas.markShown();
+    return true;
+  }
+
+private:
+  struct Committed
+  {
+    Committed(const MinuTransaction &tx) : transaction(tx) {}
+    MinuTransaction transaction;
+    Committed *next;
+  };
+
+  /// @brief  Start a frame, printing the page's title and, for info pages, its canvas
+  /// @return false, if there is nothing to render
+  bool _beginFrame(uint16_t count)
+  {
+    // Changes committed by other tasks are applied between frames
+    this->applyTransactions();
+
+    // Check that the menu has registered child pages, and that the argument is valid
+    if (!this->_pages.size() || this->_currentPage >= this->_pages.size() || !count)
+      return false;
+
+    // The first page is current without goToPage() having been called, so it may not be built yet
+    MinuPage *page = this->_pages[this->_currentPage];
+    page->build();
+    ssize_t highlightedIndex = page->highlightedIndex();
+    this->_framePage = this->_currentPage;
+    this->_frameHighlight = highlightedIndex;
+    this->_frameItemCount = page->getItemCount();
+    this->_frameItem = (highlightedIndex >= 0) ? highlightedIndex : this->_frameItemCount;
+    this->_frameRemaining = count;
+
+    // Status changes made from here on are picked up by the next render
+    for (size_t i = 0; i < page->items().size(); ++i)
+      page->items()[i].clearStatusChanged();
+
+    this->_backend.begin(false);
+    if (this->_observer)
+      this->_observer->frameStarted(this->_currentPage, highlightedIndex, false);
+
+    // The title text is padded with underscores(_) on either side so we distribute the padding equally on both sides.
+    // If the number of underscores is odd, the extra one is post-fixed.
+    // The parts are printed one after the other rather than copied into a line, so the title fits any page width
+    const uint32_t pageWidth = (uint32_t)this->_mainTextLen + this->_auxTextLen;
+    size_t titleLen = (page->title()) ? strlen(page->title()) : 0;
+    uint32_t padding = (pageWidth > titleLen) ? (pageWidth - titleLen) : 1;
+    uint32_t paddingLeft = padding / 2;
+    uint32_t paddingRight = (padding != 1) ? (padding / 2) + (padding % 2) : 0;
+
+    if (titleLen > UINT16_MAX)
+      titleLen = UINT16_MAX;
+    if (page->title() && titleLen)
+    {
+      this->_printRepeated(MINU_TITLE_PADDING_DEFAULT[0], paddingLeft);
+      this->_print(page->title(), titleLen, MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+      this->_printRepeated(MINU_TITLE_PADDING_DEFAULT[0], paddingRight);
+      this->_print("\n\n", strlen("\n\n"), MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+    }
+
+    // Info pages print their canvas below the title, all at once so that it is marked shown as it was printed
+    if (page->infoMode())
+    {
+      this->_canvasRow = (page->title() && titleLen) ? 2 : 0;
+      for (uint16_t r = 0; r < this->_canvas.rows(); ++r)
       {
-        // If the item has no main text, skip it
-        if (!this->_pages[this->_currentPage]->getItem(it).getMainText(printBuff, sizeof(printBuff)))
-          continue;
+        this->_printCells(this->_canvas.content().row(r), this->_canvas.cols());
+        this->_print("\n", strlen("\n"), MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+      }
+      this->_canvas.markShown();
+    }
+    return true;
+  }
 
-        this->_print_txt(printBuff, (this->_pages[this->_currentPage]->getItem(it).auxTextLength()) ? (this->_mainTextLen) : pageWidth, MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+  /// @brief  Print the next of the page's items
+  /// @note   The highlighted item is always the first to be rendered so that changing the highlighted index creates a scrolling effect
+  /// @return false, once there are no more items to print
+  bool _renderNextRow(void)
+  {
+    MinuPage *page = this->_pages[this->_framePage];
 
-        // If the item has auxiliary text, print it in custom colour.
-        if (this->_pages[this->_currentPage]->getItem(it).getAuxText(printBuff, sizeof(printBuff)))
-        {
-          this->_print_txt(MINU_ITEM_TEXT_SEPARATOR_DEFAULT, strlen(MINU_ITEM_TEXT_SEPARATOR_DEFAULT), MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
-          this->_print_txt(printBuff, this->_pages[this->_currentPage]->getItem(it).auxTextLength(),
-                    this->_pages[this->_currentPage]->getItem(it).auxTextForeground(),
-                    this->_pages[this->_currentPage]->getItem(it).auxTextBackground());
-        }
-        this->_print_txt("\n", strlen("\n"), MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+    // Don't print items if the page has the infoMode flag set
+    if (page->infoMode())
+      return false;
+
+    const uint32_t pageWidth = (uint32_t)this->_mainTextLen + this->_auxTextLen;
+    const uint16_t mainWidth = (pageWidth > UINT16_MAX) ? UINT16_MAX : pageWidth;
+    while (this->_frameRemaining && this->_frameItem < this->_frameItemCount)
+    {
+      size_t it = this->_frameItem++;
+
+      // Each item is fetched once per row, since a page with a source reads it on demand.
+      // Its texts are printed from where they are stored, the backend truncating or padding them to the width given
+      const MinuPageItem *item = page->item(it);
+
+      // If the item has no main text, skip it
+      if (!item || !item->mainTextLength())
+        continue;
+
+      // If the current index is the index of page's highlighted item, print it inverted
+      bool highlighted = (ssize_t)it == this->_frameHighlight;
+      size_t auxLen = item->auxTextLength();
+      uint16_t mainLen = (auxLen) ? this->_mainTextLen : mainWidth;
+      if (highlighted)
+        this->_printInverted(item->mainText(), mainLen, MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+      else
+        this->_print(item->mainText(), mainLen, MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+
+      // If the item has auxiliary text, print it in custom colour.
+      // For proper presentation, an item's auxiliary text is not highlighted. Only the main text is highlighted
+      if (auxLen)
+      {
+        this->_print(MINU_ITEM_TEXT_SEPARATOR_DEFAULT, strlen(MINU_ITEM_TEXT_SEPARATOR_DEFAULT), MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+        // Both colours are read at once, since they may be changed by another task
+        uint32_t auxColours = item->auxTextColours();
+        this->_print(item->auxText(), (auxLen > UINT16_MAX) ? UINT16_MAX : auxLen,
+                  auxColours & 0xFFFF, auxColours >> 16);
       }
 
+      if (highlighted)
+        this->_printInverted("\n", strlen("\n"), MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+      else
+        this->_print("\n", strlen("\n"), MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+
       // Keep track of how many items have been printed and stop if we've printed the specified maximum
-      if (!--count)
-        break;
+      this->_frameRemaining--;
+      return this->_frameRemaining && this->_frameItem < this->_frameItemCount;
     }
+    return false;
+  }
+
+  /// @brief Complete the frame and call the page's rendered callback
+  void _finishFrame(void)
+  {
+    this->_backend.flush();
+    if (this->_observer)
+      this->_observer->frameFinished();
+
     // The menu has now been rendered
     this->_rendered = true;
     // Call the page's rendered callback functtion
-    this->_pages[this->_currentPage]->callRenderedCallback();
+    this->_pages[this->_framePage]->callRenderedCallback();
+  }
+
+  /// @brief Close a frame left incomplete by renderPart(), so that the backend sees every frame it began end
+  void _abandonFrame(void)
+  {
+    this->_frameOpen = false;
+    this->_backend.flush();
+    if (this->_observer)
+      this->_observer->frameFinished();
+  }
+
+  /// @brief Print a sequence of cells, one fragment for each run of cells sharing the same colours
+  void _printCells(const MinuCell *cells, uint16_t count)
+  {
+    char buff[MINU_PRINT_BUFF_LEN];
+    uint16_t i = 0;
+    while (i < count)
+    {
+      uint16_t len = 0;
+      do
+        buff[len++] = cells[i++].ch;
+      while (i < count && len < sizeof(buff) - 1 && cells[i].fore == cells[i - 1].fore &&
+             cells[i].back == cells[i - 1].back);
+      buff[len] = 0;
+      this->_print(buff, len, cells[i - 1].fore, cells[i - 1].back);
+    }
+  }
+
+  /// @brief Print a character \a count times, in fragments of at most MINU_PRINT_BUFF_LEN - 1 characters
+  void _printRepeated(char ch, uint32_t count)
+  {
+    char buff[MINU_PRINT_BUFF_LEN];
+    memset(buff, ch, sizeof(buff) - 1);
+    buff[sizeof(buff) - 1] = 0;
+    while (count)
+    {
+      uint16_t len = (count < sizeof(buff) - 1) ? count : sizeof(buff) - 1;
+      buff[len] = 0;
+      this->_print(buff, len, MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+      count -= len;
+    }
+  }
+
+  /// @brief Print text using the backend and notify the render observer
+  void _print(const char *msg, uint16_t len, uint16_t fore, uint16_t back)
+  {
+    this->_backend.print(msg, len, fore, back);
+    this->_printedBytes += len;
+    if (this->_observer)
+      this->_observer->fragmentPrinted(msg, len, fore, back, false);
+  }
+
+  /// @brief Print inverted text using the backend and notify the render observer
+  void _printInverted(const char *msg, uint16_t len, uint16_t fore, uint16_t back)
+  {
+    this->_backend.printInverted(msg, len, fore, back);
+    this->_printedBytes += len;
+    if (this->_observer)
+      this->_observer->fragmentPrinted(msg, len, fore, back, true);
   }
 
-private:
   bool _rendered;
+  MinuRenderObserver *_observer;
+  MinuCallbackDispatcher *_dispatcher;
   std::vector<MinuPage *> _pages;
   ssize_t _currentPage;
-  MinuPrintFunction _print_txt;
-  MinuPrintFunction _print_txt_inverted;
-  uint8_t _mainTextLen;
-  uint8_t _auxTextLen;
+  Backend _backend;
+  uint16_t _mainTextLen;
+  uint16_t _auxTextLen;
+  MinuTextCanvas _canvas;
+  uint16_t _canvasRow;
+  std::atomic<Committed *> _committed;
+  // State of the frame being rendered, so that renderPart() can continue it
+  bool _frameOpen;
+  ssize_t _framePage;
+  ssize_t _frameHighlight;
+  size_t _frameItemCount;
+  size_t _frameItem;        // Index of the next item to print
+  uint16_t _frameRemaining; // Number of items still to print
+  size_t _printedBytes;     // Characters printed since the menu was created, to measure a byte budget
+};
+
+/// @brief Menu that prints through a pair of user-defined print functions selected at runtime
+class Minu : public MinuBasic<MinuFunctionBackend>
+{
+
+public:
+  /// @brief Class condtructor
+  /// @param print_txt          Basic used to print text to the screen
+  /// @param print_txt_inverted Basic used to print inverted colour text to the screen, used for highlighted items
+  /// @param mainTextLen        Length of the main text section of a MinuPageItem
+  /// @param auxTextLen         Length of the auxiliary text section of a MinuPageItem
+  Minu(MinuPrintFunction print_txt, MinuPrintFunction print_txt_inverted, uint16_t mainTextLen, uint16_t auxTextLen)
+      : MinuBasic<MinuFunctionBackend>(MinuFunctionBackend(print_txt, print_txt_inverted), mainTextLen, auxTextLen)
+  {
+  }
+
+  Minu() {}
+
+  void setPrintFunctions(MinuPrintFunction print, MinuPrintFunction printInverted)
+  {
+    this->backend().setPrintFunctions(print, printInverted);
+  }
+
+  /// @brief Set the function used to move the print position, which allows info pages to be updated in place
+  void setCursorFunction(MinuCursorFunction moveCursor) { this->backend().setCursorFunction(moveCursor); }
+
+#ifdef MINU_PALETTE
+  /// @brief Returns the palette the colours of items and the canvas index into, e.g. to set MINU_PALETTE_USER entries
+  MinuPalette &palette() { return this->backend().palette(); }
+#endif
 };
 
 #endif
\ No newline at end of file
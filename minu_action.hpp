@@ -0,0 +1,416 @@
+/*
+ * @file  minu_action.hpp
+ * @brief Item actions written as C++20 coroutines, run cooperatively by the Minu event loop.
+ *
+ * A link that has to wait, e.g. for a Wi-Fi scan to complete, would normally block the task running the menu, and
+ * no input is handled until it returns. Written as a coroutine returning MinuAction, the same code can instead
+ * suspend at each wait and let the loop carry on:
+ *
+ *   MinuAction scan()
+ *   {
+ *     WiFi.scanNetworks(true);
+ *     while (WiFi.scanComplete() == WIFI_SCAN_RUNNING)
+ *       co_await MinuSleep(100);
+ *     ...
+ *   }
+ *
+ *   void startScan(void *arg) { uiLoop.startAction(scan()); }
+ *
+ * An action can await:
+ *   - MinuSleep(ms)       resumes once \a ms milliseconds have passed
+ *   - MinuNextFrame()     resumes once the menu has next been rendered, e.g. to show progress before a long step
+ *   - a MinuCompletion    resumes once another task or interrupt calls complete() on it
+ *
+ * Actions run on the loop task, so they may change the menu directly and report progress through the page, its
+ * items or the canvas. An action belongs to the page that is current after it suspends, and is cancelled, i.e.
+ * destroyed at its suspension point, once the user leaves that page. An action may change page itself, e.g. to show
+ * its results, in which case it belongs to the new page.
+ *
+ * This header is empty unless the compiler supports coroutines (e.g. GCC 10+ with -std=c++20), in which case
+ * MINU_HAS_ACTIONS is defined.
+ */
+
+#ifndef _LIBMINU_ACTION_H_
+#define _LIBMINU_ACTION_H_
+
+#include <stdint.h>
+#include <atomic>
+
+#include "minu.hpp"
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define MINU_HAS_ACTIONS
+#endif
+#endif
+
+#ifdef MINU_HAS_ACTIONS
+
+#include <coroutine>
+#include <exception>
+
+#define MINU_ACTION_MAX           4           // Maximum number of actions running at once
+#define MINU_ACTION_WAIT_FOREVER  0xFFFFFFFF  // Returned when no running action is sleeping
+
+class MinuActionRunner;
+
+/// @brief  Function returning the id of the current page, e.g. MinuBasic::currentPageId()
+typedef ssize_t (*MinuPageIdFunction)(void *arg);
+
+/// @brief  Function returning the current time in milliseconds, e.g. the event loop's clock
+typedef uint32_t (*MinuTimeFunction)(void *arg);
+
+/// @brief Return type of a coroutine that can be run as a Minu action. See the top of this file for details.
+class MinuAction
+{
+
+public:
+  struct promise_type
+  {
+    MinuAction get_return_object() { return MinuAction(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+    // Actions only start running once they are given to a runner, which destroys them once they finish
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+
+    MinuActionRunner *runner = nullptr;
+    size_t slot = 0;
+  };
+
+  typedef std::coroutine_handle<promise_type> Handle;
+
+  MinuAction(MinuAction &&other) : _handle(other._handle) { other._handle = nullptr; }
+  MinuAction(const MinuAction &) = delete;
+  MinuAction &operator=(const MinuAction &) = delete;
+
+  ~MinuAction()
+  {
+    if (this->_handle)
+      this->_handle.destroy();
+  }
+
+  /// @brief Give up ownership of the coroutine
+  Handle release(void)
+  {
+    Handle handle = this->_handle;
+    this->_handle = nullptr;
+    return handle;
+  }
+
+private:
+  explicit MinuAction(Handle handle) : _handle(handle) {}
+
+  Handle _handle;
+};
+
+/// @brief Event that another task or interrupt signals to resume an action awaiting it
+/// @note  The object must outlive the action awaiting it. An event already completed does not suspend the action
+class MinuCompletion
+{
+
+public:
+  MinuCompletion()
+  {
+    this->_done.store(false);
+    this->_runner.store(NULL);
+  }
+
+  /// @brief Signal the event, waking the loop if an action is waiting for it
+  void complete(void);
+
+  /// @brief Whether the event was signalled
+  bool done() const { return this->_done.load(std::memory_order_acquire); }
+
+  /// @brief Allow the event to be awaited again
+  void reset(void) { this->_done.store(false); }
+
+  bool await_ready() const noexcept { return this->done(); }
+  bool await_suspend(MinuAction::Handle handle);
+  void await_resume() const noexcept {}
+
+private:
+  std::atomic<bool> _done;
+  std::atomic<MinuActionRunner *> _runner;
+};
+
+/// @brief Awaitable that suspends an action for a number of milliseconds
+struct MinuSleep
+{
+  explicit MinuSleep(uint32_t ms) : ms(ms) {}
+
+  bool await_ready() const noexcept { return !this->ms; }
+  void await_suspend(MinuAction::Handle handle);
+  void await_resume() const noexcept {}
+
+  uint32_t ms;
+};
+
+/// @brief Awaitable that suspends an action until the menu has next been rendered
+struct MinuNextFrame
+{
+  bool await_ready() const noexcept { return false; }
+  void await_suspend(MinuAction::Handle handle);
+  void await_resume() const noexcept {}
+};
+
+/// @brief Runs actions cooperatively. MinuEventLoop owns one, but it can also be driven by hand
+class MinuActionRunner
+{
+
+public:
+  MinuActionRunner()
+  {
+    this->_notify = NULL;
+    this->_notifyArg = NULL;
+    this->_pageId = NULL;
+    this->_pageIdArg = NULL;
+    this->_time = NULL;
+    this->_timeArg = NULL;
+    this->_now = 0;
+    for (size_t i = 0; i < MINU_ACTION_MAX; ++i)
+      this->_slots[i].handle = nullptr;
+  }
+
+  ~MinuActionRunner() { this->cancelAll(); }
+
+  /// @brief Set a function called when a completion is signalled from another task, e.g. to wake the loop
+  void setNotifyFunction(MinuCallbackFunction notify, void *arg = NULL)
+  {
+    this->_notify = notify;
+    this->_notifyArg = arg;
+  }
+
+  /// @brief Set the function returning the current page, which an action is bound to each time it suspends
+  /// @note  Without one, an action is bound to the page passed to start() or poll(), so an action that changes page
+  ///        itself is cancelled at the next poll
+  void setPageIdFunction(MinuPageIdFunction pageId, void *arg = NULL)
+  {
+    this->_pageId = pageId;
+    this->_pageIdArg = arg;
+  }
+
+  /// @brief Set the function returning the current time, which a sleep is measured from when it starts
+  /// @note  Without one, sleeps are measured from the time passed to start() or poll(), so a sleep that starts after
+  ///        another action ran for a while ends early
+  void setTimeFunction(MinuTimeFunction time, void *arg = NULL)
+  {
+    this->_time = time;
+    this->_timeArg = arg;
+  }
+
+  /// @brief  Start an action, running it until it first suspends
+  /// @param  action Action to run
+  /// @param  now    Current time in milliseconds
+  /// @param  pageId Current page, or -2 to bind the action to the page passed to the next poll()
+  /// @return false, if too many actions are already running, in which case the action is destroyed
+  bool start(MinuAction action, uint32_t now, ssize_t pageId = PAGE_UNBOUND)
+  {
+    for (size_t i = 0; i < MINU_ACTION_MAX; ++i)
+    {
+      Slot &slot = this->_slots[i];
+      if (slot.handle)
+        continue;
+
+      slot.handle = action.release();
+      slot.handle.promise().runner = this;
+      slot.handle.promise().slot = i;
+      slot.wait = WAIT_NONE;
+      slot.completion = NULL;
+      this->_now = now;
+      this->_resume(i, pageId);
+      return true;
+    }
+    return false;
+  }
+
+  /// @brief  Resume the actions whose waits are over
+  /// @param  now    Current time in milliseconds
+  /// @param  pageId Current page. Actions belonging to other pages are cancelled
+  /// @return Number of milliseconds until an action's sleep ends, or MINU_ACTION_WAIT_FOREVER
+  uint32_t poll(uint32_t now, ssize_t pageId)
+  {
+    this->_now = now;
+    for (size_t i = 0; i < MINU_ACTION_MAX; ++i)
+    {
+      Slot &slot = this->_slots[i];
+      if (!slot.handle)
+        continue;
+
+      if (slot.pageId == PAGE_UNBOUND)
+        slot.pageId = pageId;
+      if (slot.pageId != pageId)
+        this->_destroy(i);
+      else if (slot.wait == WAIT_NONE || (slot.wait == WAIT_TIMER && (int32_t)(slot.due - now) <= 0) ||
+               (slot.wait == WAIT_COMPLETION && slot.completion->done()))
+        this->_resume(i, pageId);
+    }
+    return this->timeout(now);
+  }
+
+  /// @brief Resume the actions waiting for the menu to be rendered
+  void frameRendered(void)
+  {
+    for (size_t i = 0; i < MINU_ACTION_MAX; ++i)
+      if (this->_slots[i].handle && this->_slots[i].wait == WAIT_FRAME)
+        this->_slots[i].wait = WAIT_NONE;
+  }
+
+  /// @brief Whether an action is waiting for the menu to be rendered
+  bool waitingForFrame() const
+  {
+    for (size_t i = 0; i < MINU_ACTION_MAX; ++i)
+      if (this->_slots[i].handle && this->_slots[i].wait == WAIT_FRAME)
+        return true;
+    return false;
+  }
+
+  /// @brief Returns the number of milliseconds until an action needs resuming
+  uint32_t timeout(uint32_t now) const
+  {
+    uint32_t timeout = MINU_ACTION_WAIT_FOREVER;
+    for (size_t i = 0; i < MINU_ACTION_MAX; ++i)
+    {
+      const Slot &slot = this->_slots[i];
+      if (!slot.handle)
+        continue;
+      if (slot.wait == WAIT_NONE)
+        return 0;
+      if (slot.wait != WAIT_TIMER)
+        continue;
+
+      int32_t remaining = (int32_t)(slot.due - now);
+      if (remaining <= 0)
+        return 0;
+      if ((uint32_t)remaining < timeout)
+        timeout = remaining;
+    }
+    return timeout;
+  }
+
+  /// @brief Returns the number of actions running
+  size_t active() const
+  {
+    size_t count = 0;
+    for (size_t i = 0; i < MINU_ACTION_MAX; ++i)
+      count += (this->_slots[i].handle) ? 1 : 0;
+    return count;
+  }
+
+  /// @brief Destroy every running action
+  void cancelAll(void)
+  {
+    for (size_t i = 0; i < MINU_ACTION_MAX; ++i)
+      if (this->_slots[i].handle)
+        this->_destroy(i);
+  }
+
+private:
+  friend class MinuCompletion;
+  friend struct MinuSleep;
+  friend struct MinuNextFrame;
+
+  static const ssize_t PAGE_UNBOUND = -2;
+
+  enum Wait
+  {
+    WAIT_NONE,
+    WAIT_TIMER,
+    WAIT_FRAME,
+    WAIT_COMPLETION,
+  };
+
+  struct Slot
+  {
+    MinuAction::Handle handle;
+    ssize_t pageId;
+    Wait wait;
+    uint32_t due;
+    MinuCompletion *completion;
+  };
+
+  /// @brief Run an action until it next suspends, and destroy it if it finished
+  /// @param pageId Page current before the action ran, used if there is no page id function
+  void _resume(size_t i, ssize_t pageId)
+  {
+    Slot &slot = this->_slots[i];
+    slot.wait = WAIT_NONE;
+    slot.handle.resume();
+
+    // The action may have changed page, so it belongs to the page current now that it suspended. Binding it any
+    // later would hand it to a page the user opened in the meantime, which would then keep it running
+    if (slot.handle && slot.handle.done())
+      this->_destroy(i);
+    else if (slot.handle)
+      slot.pageId = (this->_pageId) ? this->_pageId(this->_pageIdArg) : pageId;
+  }
+
+  void _destroy(size_t i)
+  {
+    MinuAction::Handle handle = this->_slots[i].handle;
+    this->_slots[i].handle = nullptr;
+    handle.destroy();
+  }
+
+  void _notifyOtherTask(void)
+  {
+    if (this->_notify)
+      this->_notify(this->_notifyArg);
+  }
+
+  MinuCallbackFunction _notify;
+  void *_notifyArg;
+  /// @brief Returns the current time, as read now if possible
+  uint32_t _currentTime(void) const { return (this->_time) ? this->_time(this->_timeArg) : this->_now; }
+
+  MinuPageIdFunction _pageId;
+  void *_pageIdArg;
+  MinuTimeFunction _time;
+  void *_timeArg;
+  uint32_t _now;
+  Slot _slots[MINU_ACTION_MAX];
+};
+
+inline void MinuCompletion::complete(void)
+{
+  this->_done.store(true, std::memory_order_release);
+  MinuActionRunner *runner = this->_runner.load(std::memory_order_acquire);
+  if (runner)
+    runner->_notifyOtherTask();
+}
+
+inline bool MinuCompletion::await_suspend(MinuAction::Handle handle)
+{
+  MinuActionRunner *runner = handle.promise().runner;
+  MinuActionRunner::Slot &slot = runner->_slots[handle.promise().slot];
+  slot.wait = MinuActionRunner::WAIT_COMPLETION;
+  slot.completion = this;
+  this->_runner.store(runner, std::memory_order_release);
+
+  // The event may have been signalled before the runner was recorded, in which case nobody would wake the loop
+  if (this->done())
+  {
+    slot.wait = MinuActionRunner::WAIT_NONE;
+    return false;
+  }
+  return true;
+}
+
+inline void MinuSleep::await_suspend(MinuAction::Handle handle)
+{
+  MinuActionRunner *runner = handle.promise().runner;
+  MinuActionRunner::Slot &slot = runner->_slots[handle.promise().slot];
+  slot.wait = MinuActionRunner::WAIT_TIMER;
+  slot.due = runner->_currentTime() + this->ms;
+}
+
+inline void MinuNextFrame::await_suspend(MinuAction::Handle handle)
+{
+  MinuActionRunner *runner = handle.promise().runner;
+  runner->_slots[handle.promise().slot].wait = MinuActionRunner::WAIT_FRAME;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,224 @@
+/*
+ * @file  minu_blit.hpp
+ * @brief RGB565 pixel kernels used by the Minu pixel renderer.
+ *
+ * Two operations dominate rasterising text: expanding 1-bit glyph rows into 16-bit foreground/background
+ * pixels, and filling spans of pixels with a background colour. Each kernel has a portable implementation that
+ * writes two pixels per 32-bit word (suitable for the ESP32) and, where the compiler targets them,
+ * SSE2, AVX2 and NEON implementations. minuExpandBits() and minuFill565() select the widest one available
+ * at compile time. Define MINU_BLIT_SCALAR to always use the portable kernels.
+ */
+
+#ifndef _LIBMINU_BLIT_H_
+#define _LIBMINU_BLIT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#if !defined(MINU_BLIT_SCALAR)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define MINU_BLIT_AVX2
+#endif
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define MINU_BLIT_SSE2
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define MINU_BLIT_NEON
+#endif
+#endif
+
+/// @brief Write one pixel per bit of a packed bitstream
+/// @param dst   Destination pixels
+/// @param bits  Bitstream, most significant bit of the first byte first
+/// @param count Number of pixels to write
+/// @param fore  Colour of set bits
+/// @param back  Colour of clear bits
+inline void minuExpandBitsScalar(uint16_t *dst, const uint8_t *bits, size_t count, uint16_t fore, uint16_t back)
+{
+  // Align the destination to a word so that the main loop can write two pixels at a time
+  size_t bit = 0;
+  if (((uintptr_t)dst & 3) && count)
+  {
+    *dst++ = (bits[0] & 0x80) ? fore : back;
+    bit = 1;
+  }
+
+  // Every possible pair of pixels, indexed by two consecutive bits (first pixel in the low half-word)
+  uint32_t pairs[4];
+  pairs[0] = back | ((uint32_t)back << 16);
+  pairs[1] = fore | ((uint32_t)back << 16);
+  pairs[2] = back | ((uint32_t)fore << 16);
+  pairs[3] = fore | ((uint32_t)fore << 16);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  for (uint8_t i = 0; i < 4; ++i)
+    pairs[i] = (pairs[i] >> 16) | (pairs[i] << 16);
+#endif
+
+  // Words are written with memcpy() to avoid type-punning the pixel buffer. The compiler still emits single
+  // aligned stores, since the destination is known to be word-aligned
+  uint8_t *out = (uint8_t *)__builtin_assume_aligned(dst, 4);
+  for (; bit + 2 <= count; bit += 2, out += 4)
+  {
+    uint8_t offset = bit & 7;
+    uint8_t pair;
+    if (offset == 7)
+      pair = ((bits[bit >> 3] & 1) << 1) | (bits[(bit >> 3) + 1] >> 7);
+    else
+      pair = (bits[bit >> 3] >> (6 - offset)) & 3;
+    // The first (higher) bit of the pair selects the pixel in the low half-word
+    memcpy(out, &pairs[((pair & 1) << 1) | (pair >> 1)], 4);
+  }
+
+  if (bit < count)
+  {
+    uint16_t last = (bits[bit >> 3] & (0x80 >> (bit & 7))) ? fore : back;
+    memcpy(out, &last, 2);
+  }
+}
+
+/// @brief Fill pixels with a single colour
+inline void minuFill565Scalar(uint16_t *dst, size_t count, uint16_t colour)
+{
+  if (((uintptr_t)dst & 3) && count)
+  {
+    *dst++ = colour;
+    count--;
+  }
+
+  uint32_t pair = colour | ((uint32_t)colour << 16);
+  uint8_t *out = (uint8_t *)__builtin_assume_aligned(dst, 4);
+  for (size_t i = 0; i < count / 2; ++i, out += 4)
+    memcpy(out, &pair, 4);
+
+  if (count & 1)
+    dst[count - 1] = colour;
+}
+
+#ifdef MINU_BLIT_SSE2
+inline void minuExpandBitsSse2(uint16_t *dst, const uint8_t *bits, size_t count, uint16_t fore, uint16_t back)
+{
+  const __m128i lanes = _mm_set_epi16(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+  const __m128i vfore = _mm_set1_epi16(fore);
+  const __m128i vback = _mm_set1_epi16(back);
+
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    __m128i mask = _mm_and_si128(_mm_set1_epi16(bits[i >> 3]), lanes);
+    mask = _mm_cmpeq_epi16(mask, lanes);
+    __m128i px = _mm_or_si128(_mm_and_si128(mask, vfore), _mm_andnot_si128(mask, vback));
+    _mm_storeu_si128((__m128i *)(dst + i), px);
+  }
+
+  if (i < count)
+    minuExpandBitsScalar(dst + i, bits + (i >> 3), count - i, fore, back);
+}
+
+inline void minuFill565Sse2(uint16_t *dst, size_t count, uint16_t colour)
+{
+  const __m128i v = _mm_set1_epi16(colour);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+    _mm_storeu_si128((__m128i *)(dst + i), v);
+  for (; i < count; ++i)
+    dst[i] = colour;
+}
+#endif
+
+#ifdef MINU_BLIT_AVX2
+inline void minuExpandBitsAvx2(uint16_t *dst, const uint8_t *bits, size_t count, uint16_t fore, uint16_t back)
+{
+  const __m256i lanes = _mm256_set_epi16(0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0020, 0x0040, 0x0080,
+                                         0x0100, 0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, (short)0x8000);
+  const __m256i vfore = _mm256_set1_epi16(fore);
+  const __m256i vback = _mm256_set1_epi16(back);
+
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16)
+  {
+    // The first byte supplies the first 8 pixels, so it goes in the high half of each lane's test word
+    uint16_t word = ((uint16_t)bits[i >> 3] << 8) | bits[(i >> 3) + 1];
+    __m256i mask = _mm256_and_si256(_mm256_set1_epi16(word), lanes);
+    mask = _mm256_cmpeq_epi16(mask, lanes);
+    _mm256_storeu_si256((__m256i *)(dst + i), _mm256_blendv_epi8(vback, vfore, mask));
+  }
+
+  if (i < count)
+    minuExpandBitsSse2(dst + i, bits + (i >> 3), count - i, fore, back);
+}
+
+inline void minuFill565Avx2(uint16_t *dst, size_t count, uint16_t colour)
+{
+  const __m256i v = _mm256_set1_epi16(colour);
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16)
+    _mm256_storeu_si256((__m256i *)(dst + i), v);
+  if (i < count)
+    minuFill565Sse2(dst + i, count - i, colour);
+}
+#endif
+
+#ifdef MINU_BLIT_NEON
+inline void minuExpandBitsNeon(uint16_t *dst, const uint8_t *bits, size_t count, uint16_t fore, uint16_t back)
+{
+  static const uint16_t laneBits[8] = {0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01};
+  const uint16x8_t lanes = vld1q_u16(laneBits);
+  const uint16x8_t vfore = vdupq_n_u16(fore);
+  const uint16x8_t vback = vdupq_n_u16(back);
+
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    uint16x8_t mask = vtstq_u16(vdupq_n_u16(bits[i >> 3]), lanes);
+    vst1q_u16(dst + i, vbslq_u16(mask, vfore, vback));
+  }
+
+  if (i < count)
+    minuExpandBitsScalar(dst + i, bits + (i >> 3), count - i, fore, back);
+}
+
+inline void minuFill565Neon(uint16_t *dst, size_t count, uint16_t colour)
+{
+  const uint16x8_t v = vdupq_n_u16(colour);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+    vst1q_u16(dst + i, v);
+  for (; i < count; ++i)
+    dst[i] = colour;
+}
+#endif
+
+/// @brief Write one pixel per bit of a packed bitstream, using the widest kernel available
+/// @note  See minuExpandBitsScalar() for a description of the parameters
+inline void minuExpandBits(uint16_t *dst, const uint8_t *bits, size_t count, uint16_t fore, uint16_t back)
+{
+#if defined(MINU_BLIT_AVX2)
+  minuExpandBitsAvx2(dst, bits, count, fore, back);
+#elif defined(MINU_BLIT_SSE2)
+  minuExpandBitsSse2(dst, bits, count, fore, back);
+#elif defined(MINU_BLIT_NEON)
+  minuExpandBitsNeon(dst, bits, count, fore, back);
+#else
+  minuExpandBitsScalar(dst, bits, count, fore, back);
+#endif
+}
+
+/// @brief Fill pixels with a single colour, using the widest kernel available
+inline void minuFill565(uint16_t *dst, size_t count, uint16_t colour)
+{
+#if defined(MINU_BLIT_AVX2)
+  minuFill565Avx2(dst, count, colour);
+#elif defined(MINU_BLIT_SSE2)
+  minuFill565Sse2(dst, count, colour);
+#elif defined(MINU_BLIT_NEON)
+  minuFill565Neon(dst, count, colour);
+#else
+  minuFill565Scalar(dst, count, colour);
+#endif
+}
+
+#endif
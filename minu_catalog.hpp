@@ -0,0 +1,489 @@
+/*
+ * @file  minu_catalog.hpp
+ * @brief Item source reading large catalogs (logs, saved networks, device lists) from an indexed file.
+ *
+ * A page given a MinuCatalog as its item source only holds the few blocks of items it has recently shown, so it can
+ * browse catalogs far larger than would fit in RAM.
+ *
+ * File layout (multi-byte fields are little-endian):
+ *
+ *   header  16 bytes  "MCAT", version (2 bytes), reserved (2 bytes), item count (4 bytes), index offset (4 bytes)
+ *   records           foreground (2 bytes), background (2 bytes), main text, NUL, auxiliary text, NUL
+ *   index             Offset of each record from the start of the file (4 bytes each), then the end of the last one
+ *
+ * Items are read in blocks of MINU_CATALOG_BLOCK_ITEMS consecutive records, with one read of the index and one of the
+ * records, and the MINU_CATALOG_CACHE_BLOCKS blocks used last are kept. When an item is read from a different block
+ * than the previous item, the next block in that direction is read as well, so that scrolling steadily through the
+ * catalog rarely waits for storage.
+ *
+ * Files are accessed through a reader class, which provides open(path), close(), size() and
+ * read(offset, buff, len). MinuFileReader uses stdio, which on the ESP32 also covers SD cards and flash filesystems
+ * mounted in the VFS, and MinuMmapReader maps the whole file on Linux. Catalogs are written with MinuCatalogWriter.
+ */
+
+#ifndef _LIBMINU_CATALOG_H_
+#define _LIBMINU_CATALOG_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "minu.hpp"
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define MINU_CATALOG_MAGIC          "MCAT"
+#define MINU_CATALOG_VERSION        1
+#define MINU_CATALOG_HEADER_LEN     16
+#define MINU_CATALOG_BLOCK_ITEMS    16  // Number of items read from the file at once
+#define MINU_CATALOG_CACHE_BLOCKS   4   // Number of blocks kept in memory. At least 2, to prefetch without evicting
+
+#if MINU_CATALOG_CACHE_BLOCKS < 2
+#error "MINU_CATALOG_CACHE_BLOCKS must be at least 2"
+#endif
+
+/// @brief Reads a file with stdio
+class MinuFileReader
+{
+
+public:
+  MinuFileReader() : _file(NULL), _size(0) {}
+  ~MinuFileReader() { this->close(); }
+
+  MinuFileReader(const MinuFileReader &) = delete;
+  MinuFileReader &operator=(const MinuFileReader &) = delete;
+
+  /// @return false, if the file could not be opened
+  bool open(const char *path)
+  {
+    this->close();
+    this->_file = fopen(path, "rb");
+    if (!this->_file)
+      return false;
+    fseek(this->_file, 0, SEEK_END);
+    this->_size = ftell(this->_file);
+    return true;
+  }
+
+  void close(void)
+  {
+    if (this->_file)
+      fclose(this->_file);
+    this->_file = NULL;
+    this->_size = 0;
+  }
+
+  /// @brief Returns the size of the file in bytes
+  size_t size() const { return this->_size; }
+
+  /// @return false, if fewer than \a len bytes could be read
+  bool read(uint32_t offset, void *buff, size_t len)
+  {
+    if (!this->_file || fseek(this->_file, offset, SEEK_SET))
+      return false;
+    return fread(buff, 1, len, this->_file) == len;
+  }
+
+private:
+  FILE *_file;
+  size_t _size;
+};
+
+#ifdef __linux__
+/// @brief Reads a file mapped into memory
+class MinuMmapReader
+{
+
+public:
+  MinuMmapReader() : _data(NULL), _size(0) {}
+  ~MinuMmapReader() { this->close(); }
+
+  MinuMmapReader(const MinuMmapReader &) = delete;
+  MinuMmapReader &operator=(const MinuMmapReader &) = delete;
+
+  /// @return false, if the file could not be opened or mapped
+  bool open(const char *path)
+  {
+    this->close();
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0)
+      return false;
+
+    struct stat st;
+    if (fstat(fd, &st) || !st.st_size)
+    {
+      ::close(fd);
+      return false;
+    }
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED)
+      return false;
+
+    this->_data = (const uint8_t *)data;
+    this->_size = st.st_size;
+    return true;
+  }
+
+  void close(void)
+  {
+    if (this->_data)
+      munmap((void *)this->_data, this->_size);
+    this->_data = NULL;
+    this->_size = 0;
+  }
+
+  /// @brief Returns the size of the file in bytes
+  size_t size() const { return this->_size; }
+
+  /// @return false, if the range lies outside the file
+  bool read(uint32_t offset, void *buff, size_t len)
+  {
+    if (!this->_data || offset > this->_size || len > this->_size - offset)
+      return false;
+    memcpy(buff, this->_data + offset, len);
+    return true;
+  }
+
+private:
+  const uint8_t *_data;
+  size_t _size;
+};
+#endif
+
+/// @brief Counts of how items were read, since the catalog was opened or the counts reset
+struct MinuCatalogStats
+{
+  uint32_t hits;       // Items found in a cached block
+  uint32_t misses;     // Items whose block had to be read
+  uint32_t prefetches; // Blocks read ahead of being needed
+  uint32_t reads;      // Calls to the reader
+  uint32_t bytesRead;
+};
+
+/// @brief Item source reading an indexed catalog file. See the top of this file for details.
+/// @note  Items are given their index in the catalog as their id, so that a link shared by all items can tell which
+///        one was selected
+template <class Reader = MinuFileReader>
+class MinuCatalog : public MinuItemSource
+{
+
+public:
+  MinuCatalog()
+  {
+    this->_count = 0;
+    this->_indexOffset = 0;
+    this->_link = NULL;
+    this->_highlightedCallback = NULL;
+    this->_reset();
+  }
+
+  /// @brief  Open a catalog file, replacing the one currently open
+  /// @return false, if the file could not be opened or is not a valid catalog
+  bool open(const char *path)
+  {
+    this->close();
+    if (!this->_reader.open(path))
+      return false;
+
+    uint8_t header[MINU_CATALOG_HEADER_LEN];
+    if (!this->_read(0, header, sizeof(header)) || memcmp(header, MINU_CATALOG_MAGIC, 4) ||
+        _getU16(header + 4) != MINU_CATALOG_VERSION)
+    {
+      this->close();
+      return false;
+    }
+
+    uint32_t count = _getU32(header + 8);
+    uint32_t indexOffset = _getU32(header + 12);
+    if (indexOffset < MINU_CATALOG_HEADER_LEN || indexOffset > this->_reader.size() ||
+        ((uint64_t)count + 1) * 4 > this->_reader.size() - indexOffset)
+    {
+      this->close();
+      return false;
+    }
+
+    this->_count = count;
+    this->_indexOffset = indexOffset;
+    return true;
+  }
+
+  void close(void)
+  {
+    this->_reader.close();
+    this->_count = 0;
+    this->_reset();
+  }
+
+  /// @brief Set the link and highlighted callback given to every item
+  void setCallbacks(MinuCallbackFunction link, MinuCallbackFunction highlightedCallback = NULL)
+  {
+    this->_link = link;
+    this->_highlightedCallback = highlightedCallback;
+  }
+
+  size_t itemCount() { return this->_count; }
+
+  MinuPageItem *loadItem(size_t index)
+  {
+    if (index >= this->_count)
+      return NULL;
+
+    ssize_t number = index / MINU_CATALOG_BLOCK_ITEMS;
+    Block *block = this->_find(number);
+    if (block)
+      this->_stats.hits++;
+    else
+    {
+      this->_stats.misses++;
+      block = this->_load(number);
+      if (!block)
+        return NULL;
+    }
+    block->lastUse = ++this->_useCount;
+
+    // Records end with the NUL of their auxiliary text, so both texts can be used in place
+    size_t i = index % MINU_CATALOG_BLOCK_ITEMS;
+    size_t begin = block->offsets[i] - block->offsets[0];
+    size_t end = block->offsets[i + 1] - block->offsets[0];
+    if (begin + 6 > end || end > block->data.size() || block->data[end - 1])
+      return NULL;
+    const char *mainText = (const char *)&block->data[begin + 4];
+    size_t mainLen = strnlen(mainText, end - begin - 5);
+    if (begin + 4 + mainLen + 1 >= end)
+      return NULL;
+
+    this->_item = MinuPageItem(index, this->_link, mainText, mainText + mainLen + 1, this->_highlightedCallback,
+                        _getU16(&block->data[begin]), _getU16(&block->data[begin + 2]));
+
+    // Moving into another block suggests the reader will carry on in the same direction
+    if (this->_lastBlock >= 0 && number != this->_lastBlock)
+    {
+      ssize_t next = number + ((number > this->_lastBlock) ? 1 : -1);
+      if (next >= 0 && (size_t)next * MINU_CATALOG_BLOCK_ITEMS < this->_count && !this->_find(next) && this->_load(next))
+        this->_stats.prefetches++;
+    }
+    this->_lastBlock = number;
+    return &this->_item;
+  }
+
+  /// @brief Returns a reference to the reader
+  Reader &reader() { return this->_reader; }
+
+  const MinuCatalogStats &stats() const { return this->_stats; }
+
+  void resetStats(void) { memset(&this->_stats, 0, sizeof(this->_stats)); }
+
+  /// @brief Returns the RAM used by the cached blocks
+  MinuMemoryUsage memoryUsage() const
+  {
+    MinuMemoryUsage usage;
+    usage.caches = sizeof(this->_blocks);
+    for (size_t i = 0; i < MINU_CATALOG_CACHE_BLOCKS; ++i)
+      usage.caches += this->_blocks[i].data.capacity();
+    return usage;
+  }
+
+private:
+  struct Block
+  {
+    ssize_t number;
+    uint32_t lastUse;
+    uint32_t offsets[MINU_CATALOG_BLOCK_ITEMS + 1];
+    std::vector<uint8_t> data;
+  };
+
+  /// @brief Returns the cached block with the given number, or NULL
+  Block *_find(ssize_t number)
+  {
+    for (size_t i = 0; i < MINU_CATALOG_CACHE_BLOCKS; ++i)
+      if (this->_blocks[i].number == number)
+        return &this->_blocks[i];
+    return NULL;
+  }
+
+  /// @brief  Read a block into the least recently used slot
+  /// @return NULL, if the block could not be read
+  Block *_load(ssize_t number)
+  {
+    Block *block = &this->_blocks[0];
+    for (size_t i = 1; i < MINU_CATALOG_CACHE_BLOCKS; ++i)
+      if (this->_blocks[i].lastUse < block->lastUse)
+        block = &this->_blocks[i];
+    block->number = -1;
+    block->lastUse = 0;
+
+    size_t first = number * MINU_CATALOG_BLOCK_ITEMS;
+    size_t count = this->_count - first;
+    if (count > MINU_CATALOG_BLOCK_ITEMS)
+      count = MINU_CATALOG_BLOCK_ITEMS;
+
+    uint8_t index[(MINU_CATALOG_BLOCK_ITEMS + 1) * 4];
+    if (!this->_read(this->_indexOffset + first * 4, index, (count + 1) * 4))
+      return NULL;
+    for (size_t i = 0; i <= count; ++i)
+    {
+      block->offsets[i] = _getU32(index + i * 4);
+      if (i && block->offsets[i] < block->offsets[i - 1])
+        return NULL;
+    }
+    // Offsets past the last item of a short block repeat its end, so that every record's end can be looked up
+    for (size_t i = count + 1; i <= MINU_CATALOG_BLOCK_ITEMS; ++i)
+      block->offsets[i] = block->offsets[count];
+
+    if (block->offsets[count] > this->_indexOffset)
+      return NULL;
+    block->data.resize(block->offsets[count] - block->offsets[0]);
+    if (!this->_read(block->offsets[0], block->data.data(), block->data.size()))
+      return NULL;
+
+    block->number = number;
+    block->lastUse = this->_useCount;
+    return block;
+  }
+
+  bool _read(uint32_t offset, void *buff, size_t len)
+  {
+    this->_stats.reads++;
+    this->_stats.bytesRead += len;
+    return this->_reader.read(offset, buff, len);
+  }
+
+  void _reset(void)
+  {
+    for (size_t i = 0; i < MINU_CATALOG_CACHE_BLOCKS; ++i)
+    {
+      this->_blocks[i].number = -1;
+      this->_blocks[i].lastUse = 0;
+    }
+    this->_useCount = 0;
+    this->_lastBlock = -1;
+    this->resetStats();
+  }
+
+  static uint16_t _getU16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+  static uint32_t _getU32(const uint8_t *p)
+  {
+    return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+  }
+
+  Reader _reader;
+  uint32_t _count;
+  uint32_t _indexOffset;
+  Block _blocks[MINU_CATALOG_CACHE_BLOCKS];
+  uint32_t _useCount;
+  ssize_t _lastBlock;
+  MinuCallbackFunction _link;
+  MinuCallbackFunction _highlightedCallback;
+  MinuPageItem _item;
+  MinuCatalogStats _stats;
+};
+
+/// @brief Writes a catalog file, one item at a time
+/// @note  The offset of every record is kept in memory until finish() writes the index
+class MinuCatalogWriter
+{
+
+public:
+  MinuCatalogWriter() : _file(NULL), _offset(0), _ok(false) {}
+  ~MinuCatalogWriter() { this->finish(); }
+
+  MinuCatalogWriter(const MinuCatalogWriter &) = delete;
+  MinuCatalogWriter &operator=(const MinuCatalogWriter &) = delete;
+
+  /// @return false, if the file could not be created
+  bool begin(const char *path)
+  {
+    this->finish();
+    this->_file = fopen(path, "wb");
+    if (!this->_file)
+      return false;
+
+    // The header is written again with the count and index offset once they are known
+    uint8_t header[MINU_CATALOG_HEADER_LEN] = {0};
+    this->_offsets.clear();
+    this->_offset = 0;
+    this->_ok = true;
+    this->_write(header, sizeof(header));
+    return this->_ok;
+  }
+
+  /// @brief  Append an item
+  /// @return false, if the file could not be written
+  bool add(const char *mainText, const char *auxText, uint16_t auxFore = MINU_FOREGROUND_COLOUR_DEFAULT,
+           uint16_t auxBack = MINU_BACKGROUND_COLOUR_DEFAULT)
+  {
+    if (!this->_file)
+      return false;
+
+    uint8_t colours[4] = {(uint8_t)auxFore, (uint8_t)(auxFore >> 8), (uint8_t)auxBack, (uint8_t)(auxBack >> 8)};
+    mainText = (mainText) ? mainText : "";
+    auxText = (auxText) ? auxText : "";
+    this->_offsets.push_back(this->_offset);
+    this->_write(colours, sizeof(colours));
+    this->_write(mainText, strlen(mainText) + 1);
+    this->_write(auxText, strlen(auxText) + 1);
+    return this->_ok;
+  }
+
+  /// @brief  Write the index and close the file
+  /// @return false, if any part of the file could not be written
+  bool finish(void)
+  {
+    if (!this->_file)
+      return false;
+
+    uint32_t indexOffset = this->_offset;
+    this->_offsets.push_back(this->_offset);
+    for (size_t i = 0; i < this->_offsets.size(); ++i)
+    {
+      uint8_t offset[4];
+      _putU32(offset, this->_offsets[i]);
+      this->_write(offset, sizeof(offset));
+    }
+
+    uint8_t header[MINU_CATALOG_HEADER_LEN] = {0};
+    memcpy(header, MINU_CATALOG_MAGIC, 4);
+    header[4] = MINU_CATALOG_VERSION;
+    _putU32(header + 8, this->_offsets.size() - 1);
+    _putU32(header + 12, indexOffset);
+    if (fseek(this->_file, 0, SEEK_SET))
+      this->_ok = false;
+    this->_write(header, sizeof(header));
+
+    if (fclose(this->_file))
+      this->_ok = false;
+    this->_file = NULL;
+    std::vector<uint32_t>().swap(this->_offsets);
+    return this->_ok;
+  }
+
+private:
+  void _write(const void *data, size_t len)
+  {
+    if (fwrite(data, 1, len, this->_file) != len)
+      this->_ok = false;
+    this->_offset += len;
+  }
+
+  static void _putU32(uint8_t *p, uint32_t v)
+  {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+  }
+
+  FILE *_file;
+  std::vector<uint32_t> _offsets;
+  uint32_t _offset;
+  bool _ok;
+};
+
+#endif
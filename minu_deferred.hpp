@@ -0,0 +1,122 @@
+/*
+ * @file  minu_deferred.hpp
+ * @brief Queue that defers the callbacks a Minu makes while navigating, so that they run off the navigation path.
+ *
+ * Highlighting an item or changing page normally calls the item's highlighted callback, or the pages' closed and
+ * opened callbacks, before returning. When those callbacks are slow, so is navigation. Once a MinuDeferredCallbacks
+ * is set as a Minu's callback dispatcher, those calls are recorded in a bounded lock-free queue instead, and are made
+ * in order the next time runPending() is called, e.g. by MinuEventLoop after it has rendered the new state, or by
+ * a worker task of their own.
+ *
+ * When the queue is full, the pending calls are made on the dispatching task before the new call is queued, so that
+ * calls are still made in order. Only when calls are already being made, by another task or because a deferred
+ * callback navigated, is the new call made immediately, ahead of the calls still pending.
+ *
+ * Deferred callbacks receive the same arguments as immediate ones. An item callback is skipped if items were added
+ * to, removed from or reordered on its page by the time it runs, since its index may then be another item's. Pages
+ * must not be removed while calls for them are pending.
+ */
+
+#ifndef _LIBMINU_DEFERRED_H_
+#define _LIBMINU_DEFERRED_H_
+
+#include <stdint.h>
+#include <atomic>
+
+#include "minu.hpp"
+#include "minu_queue.hpp"
+
+#define MINU_DEFERRED_QUEUE_LEN  16  // Maximum number of pending callbacks. Must be a power of two
+
+/// @brief Callback dispatcher that queues calls until runPending() is called. See the top of this file for details.
+class MinuDeferredCallbacks : public MinuCallbackDispatcher
+{
+
+public:
+  MinuDeferredCallbacks()
+  {
+    this->_notify = NULL;
+    this->_notifyArg = NULL;
+    this->_overflows.store(0);
+    this->_running.store(false);
+  }
+
+  /// @brief Set a function called whenever a callback is queued, e.g. to wake the task that runs them
+  void setNotifyFunction(MinuCallbackFunction notify, void *arg = NULL)
+  {
+    this->_notify = notify;
+    this->_notifyArg = arg;
+  }
+
+  /// @brief  Queue a call
+  /// @note   If the queue is full, the pending calls are made first, on the calling task, to make room
+  /// @return false, if the queue is full while calls are being made elsewhere. The caller then makes the call
+  ///         immediately, so no callback is lost
+  bool dispatch(MinuCallbackFunction cb, MinuPage *page, ssize_t itemIndex)
+  {
+    Call call = {cb, page, itemIndex, page->itemsVersion()};
+    if (!this->_calls.push(call))
+    {
+      this->_overflows.fetch_add(1);
+      if (!this->runPending() || !this->_calls.push(call))
+        return false;
+    }
+
+    if (this->_notify)
+      this->_notify(this->_notifyArg);
+    return true;
+  }
+
+  /// @brief  Make the pending calls, in the order they were queued
+  /// @param  max Maximum number of calls to make
+  /// @return Number of calls made, which is 0 if calls are already being made, e.g. by another task
+  size_t runPending(size_t max = (size_t)-1)
+  {
+    bool idle = false;
+    if (!this->_running.compare_exchange_strong(idle, true, std::memory_order_acquire))
+      return 0;
+
+    size_t count = 0;
+    Call call;
+    while (count < max && this->_calls.pop(call))
+    {
+      count++;
+      if (call.itemIndex < 0)
+      {
+        call.cb(call.page);
+        continue;
+      }
+
+      // The item at the index may be another one if the page's items changed since the call was queued
+      MinuPageItem *item = (call.page->itemsVersion() == call.itemsVersion) ? call.page->item(call.itemIndex) : NULL;
+      if (item)
+        call.cb(item);
+    }
+    this->_running.store(false, std::memory_order_release);
+    return count;
+  }
+
+  /// @brief Whether there are calls waiting to be made
+  bool pending() const { return !this->_calls.empty(); }
+
+  /// @brief Returns the number of times the queue was full, whether the pending calls were made to make room or the
+  ///        new call was made immediately
+  uint32_t overflows() const { return this->_overflows.load(); }
+
+private:
+  struct Call
+  {
+    MinuCallbackFunction cb;
+    MinuPage *page;
+    ssize_t itemIndex;
+    uint32_t itemsVersion;  // Version of the page's items when the call was queued
+  };
+
+  MinuQueue<Call, MINU_DEFERRED_QUEUE_LEN> _calls;
+  MinuCallbackFunction _notify;
+  void *_notifyArg;
+  std::atomic<uint32_t> _overflows;
+  std::atomic<bool> _running;  // Whether calls are being made, so that they are never made by two tasks at once
+};
+
+#endif
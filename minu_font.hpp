@@ -0,0 +1,136 @@
+/*
+ * @file  minu_font.hpp
+ * @brief Bitmap font bundled with the Minu pixel renderer.
+ *
+ */
+
+#ifndef _LIBMINU_FONT_H_
+#define _LIBMINU_FONT_H_
+
+#include <stdint.h>
+
+/// @brief Monospaced bitmap font covering a contiguous range of characters.
+/// @note  Each glyph is stored as \a height rows of one byte, top row first.
+///        The most significant bit of a row is its leftmost pixel.
+struct MinuFont
+{
+  uint8_t width;        // Width of a character cell in pixels, at most 8
+  uint8_t height;       // Height of a character cell in pixels
+  char first;           // First character in the font
+  char last;            // Last character in the font
+  const uint8_t *rows;  // Glyph rows, \a height bytes per character
+
+  /// @brief Returns the rows of the glyph for the given character
+  /// @note  Characters outside the font are drawn as a space if the font has one, otherwise as its first glyph
+  const uint8_t *glyph(char c) const
+  {
+    if (c < this->first || c > this->last)
+      c = (this->first <= ' ' && this->last >= ' ') ? ' ' : this->first;
+    return this->rows + (size_t)(uint8_t)(c - this->first) * this->height;
+  }
+};
+
+/// @brief Printable ASCII glyphs drawn in a 5x7 pixel box within a 6x8 cell.
+///        This matches the proportions of the default font of most embedded TFT libraries,
+///        e.g. M5GFX and TFT_eSPI, so a text size of N corresponds to a scale of N.
+static const uint8_t MINU_FONT_6X8_ROWS[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ' '
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, // '!'
+  0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, // '"'
+  0x50, 0x50, 0xF8, 0x50, 0xF8, 0x50, 0x50, 0x00, // '#'
+  0x20, 0x78, 0xA0, 0x70, 0x28, 0xF0, 0x20, 0x00, // '$'
+  0xC0, 0xC8, 0x10, 0x20, 0x40, 0x98, 0x18, 0x00, // '%'
+  0x60, 0x90, 0xA0, 0x40, 0xA8, 0x90, 0x68, 0x00, // '&'
+  0x60, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, // '''
+  0x10, 0x20, 0x40, 0x40, 0x40, 0x20, 0x10, 0x00, // '('
+  0x40, 0x20, 0x10, 0x10, 0x10, 0x20, 0x40, 0x00, // ')'
+  0x00, 0x20, 0xA8, 0x70, 0xA8, 0x20, 0x00, 0x00, // '*'
+  0x00, 0x20, 0x20, 0xF8, 0x20, 0x20, 0x00, 0x00, // '+'
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x20, 0x40, 0x00, // ','
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, // '-'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, // '.'
+  0x00, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, // '/'
+  0x70, 0x88, 0x98, 0xA8, 0xC8, 0x88, 0x70, 0x00, // '0'
+  0x20, 0x60, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, // '1'
+  0x70, 0x88, 0x08, 0x10, 0x20, 0x40, 0xF8, 0x00, // '2'
+  0xF8, 0x10, 0x20, 0x10, 0x08, 0x88, 0x70, 0x00, // '3'
+  0x10, 0x30, 0x50, 0x90, 0xF8, 0x10, 0x10, 0x00, // '4'
+  0xF8, 0x80, 0xF0, 0x08, 0x08, 0x88, 0x70, 0x00, // '5'
+  0x30, 0x40, 0x80, 0xF0, 0x88, 0x88, 0x70, 0x00, // '6'
+  0xF8, 0x08, 0x10, 0x20, 0x40, 0x40, 0x40, 0x00, // '7'
+  0x70, 0x88, 0x88, 0x70, 0x88, 0x88, 0x70, 0x00, // '8'
+  0x70, 0x88, 0x88, 0x78, 0x08, 0x10, 0x60, 0x00, // '9'
+  0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0x00, // ':'
+  0x00, 0x60, 0x60, 0x00, 0x60, 0x20, 0x40, 0x00, // ';'
+  0x10, 0x20, 0x40, 0x80, 0x40, 0x20, 0x10, 0x00, // '<'
+  0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00, // '='
+  0x40, 0x20, 0x10, 0x08, 0x10, 0x20, 0x40, 0x00, // '>'
+  0x70, 0x88, 0x08, 0x10, 0x20, 0x00, 0x20, 0x00, // '?'
+  0x70, 0x88, 0x08, 0x68, 0xA8, 0xA8, 0x70, 0x00, // '@'
+  0x70, 0x88, 0x88, 0x88, 0xF8, 0x88, 0x88, 0x00, // 'A'
+  0xF0, 0x88, 0x88, 0xF0, 0x88, 0x88, 0xF0, 0x00, // 'B'
+  0x70, 0x88, 0x80, 0x80, 0x80, 0x88, 0x70, 0x00, // 'C'
+  0xE0, 0x90, 0x88, 0x88, 0x88, 0x90, 0xE0, 0x00, // 'D'
+  0xF8, 0x80, 0x80, 0xF0, 0x80, 0x80, 0xF8, 0x00, // 'E'
+  0xF8, 0x80, 0x80, 0xF0, 0x80, 0x80, 0x80, 0x00, // 'F'
+  0x70, 0x88, 0x80, 0xB8, 0x88, 0x88, 0x78, 0x00, // 'G'
+  0x88, 0x88, 0x88, 0xF8, 0x88, 0x88, 0x88, 0x00, // 'H'
+  0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, // 'I'
+  0x38, 0x10, 0x10, 0x10, 0x10, 0x90, 0x60, 0x00, // 'J'
+  0x88, 0x90, 0xA0, 0xC0, 0xA0, 0x90, 0x88, 0x00, // 'K'
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0x00, // 'L'
+  0x88, 0xD8, 0xA8, 0xA8, 0x88, 0x88, 0x88, 0x00, // 'M'
+  0x88, 0x88, 0xC8, 0xA8, 0x98, 0x88, 0x88, 0x00, // 'N'
+  0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, // 'O'
+  0xF0, 0x88, 0x88, 0xF0, 0x80, 0x80, 0x80, 0x00, // 'P'
+  0x70, 0x88, 0x88, 0x88, 0xA8, 0x90, 0x68, 0x00, // 'Q'
+  0xF0, 0x88, 0x88, 0xF0, 0xA0, 0x90, 0x88, 0x00, // 'R'
+  0x78, 0x80, 0x80, 0x70, 0x08, 0x08, 0xF0, 0x00, // 'S'
+  0xF8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, // 'T'
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, // 'U'
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x50, 0x20, 0x00, // 'V'
+  0x88, 0x88, 0x88, 0xA8, 0xA8, 0xA8, 0x50, 0x00, // 'W'
+  0x88, 0x88, 0x50, 0x20, 0x50, 0x88, 0x88, 0x00, // 'X'
+  0x88, 0x88, 0x88, 0x50, 0x20, 0x20, 0x20, 0x00, // 'Y'
+  0xF8, 0x08, 0x10, 0x20, 0x40, 0x80, 0xF8, 0x00, // 'Z'
+  0x70, 0x40, 0x40, 0x40, 0x40, 0x40, 0x70, 0x00, // '['
+  0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x00, 0x00, // backslash
+  0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x70, 0x00, // ']'
+  0x20, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, // '^'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, // '_'
+  0x40, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, // '`'
+  0x00, 0x00, 0x70, 0x08, 0x78, 0x88, 0x78, 0x00, // 'a'
+  0x80, 0x80, 0xB0, 0xC8, 0x88, 0x88, 0xF0, 0x00, // 'b'
+  0x00, 0x00, 0x70, 0x80, 0x80, 0x88, 0x70, 0x00, // 'c'
+  0x08, 0x08, 0x68, 0x98, 0x88, 0x88, 0x78, 0x00, // 'd'
+  0x00, 0x00, 0x70, 0x88, 0xF8, 0x80, 0x70, 0x00, // 'e'
+  0x30, 0x48, 0x40, 0xE0, 0x40, 0x40, 0x40, 0x00, // 'f'
+  0x00, 0x78, 0x88, 0x88, 0x78, 0x08, 0x70, 0x00, // 'g'
+  0x80, 0x80, 0xB0, 0xC8, 0x88, 0x88, 0x88, 0x00, // 'h'
+  0x20, 0x00, 0x60, 0x20, 0x20, 0x20, 0x70, 0x00, // 'i'
+  0x10, 0x00, 0x30, 0x10, 0x10, 0x90, 0x60, 0x00, // 'j'
+  0x80, 0x80, 0x90, 0xA0, 0xC0, 0xA0, 0x90, 0x00, // 'k'
+  0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, // 'l'
+  0x00, 0x00, 0xD0, 0xA8, 0xA8, 0x88, 0x88, 0x00, // 'm'
+  0x00, 0x00, 0xB0, 0xC8, 0x88, 0x88, 0x88, 0x00, // 'n'
+  0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, // 'o'
+  0x00, 0x00, 0xF0, 0x88, 0xF0, 0x80, 0x80, 0x00, // 'p'
+  0x00, 0x00, 0x68, 0x98, 0x78, 0x08, 0x08, 0x00, // 'q'
+  0x00, 0x00, 0xB0, 0xC8, 0x80, 0x80, 0x80, 0x00, // 'r'
+  0x00, 0x00, 0x70, 0x80, 0x70, 0x08, 0xF0, 0x00, // 's'
+  0x40, 0x40, 0xE0, 0x40, 0x40, 0x48, 0x30, 0x00, // 't'
+  0x00, 0x00, 0x88, 0x88, 0x88, 0x98, 0x68, 0x00, // 'u'
+  0x00, 0x00, 0x88, 0x88, 0x88, 0x50, 0x20, 0x00, // 'v'
+  0x00, 0x00, 0x88, 0x88, 0xA8, 0xA8, 0x50, 0x00, // 'w'
+  0x00, 0x00, 0x88, 0x50, 0x20, 0x50, 0x88, 0x00, // 'x'
+  0x00, 0x00, 0x88, 0x88, 0x78, 0x08, 0x70, 0x00, // 'y'
+  0x00, 0x00, 0xF8, 0x10, 0x20, 0x40, 0xF8, 0x00, // 'z'
+  0x10, 0x20, 0x20, 0x40, 0x20, 0x20, 0x10, 0x00, // '{'
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, // '|'
+  0x40, 0x20, 0x20, 0x10, 0x20, 0x20, 0x40, 0x00, // '}'
+  0x00, 0x00, 0x40, 0xA8, 0x10, 0x00, 0x00, 0x00, // '~'
+};
+
+static const MinuFont MINU_FONT_6X8 = {6, 8, ' ', '~', MINU_FONT_6X8_ROWS};
+
+#endif
@@ -0,0 +1,484 @@
+/*
+ * @file  minu_framebuffer.hpp
+ * @brief Optional renderer that rasterises a Minu into RGB565 pixels and flushes only the dirty rectangles.
+ *
+ * MinuPixelRenderer is a print backend for MinuBasic. Rather than forwarding text to the display, it lays the
+ * frame out on a grid of character cells, compares it with the frame previously shown, draws the cells that
+ * changed using a bundled bitmap font and hands the resulting rectangles of pixels to a panel class:
+ *
+ *   void pushRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *pixels, size_t stride)
+ *
+ * where \a pixels points to the top-left pixel of the rectangle and \a stride is the distance in pixels between
+ * its rows. On a device, pushRect() would typically start an SPI/DMA transfer to the display controller.
+ *
+ * The renderer either keeps a framebuffer for the whole grid, which allows dirty rectangles on adjacent rows
+ * to be merged, or only a band one text row high, which needs far less RAM.
+ *
+ * With MINU_PALETTE defined, the two copies of the frame hold palette indices, at two bytes per cell rather than six,
+ * and the renderer resolves them through its palette() as it draws.
+ */
+
+#ifndef _LIBMINU_FRAMEBUFFER_H_
+#define _LIBMINU_FRAMEBUFFER_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "minu.hpp"
+#include "minu_font.hpp"
+#include "minu_blit.hpp"
+
+#define MINU_PIXEL_MERGE_GAP_DEFAULT  2   // Maximum number of unchanged cells merged into a dirty rectangle
+
+/// @brief Counters describing the work done by a MinuPixelRenderer
+struct MinuPixelStats
+{
+  uint32_t frames;        // Number of frames flushed
+  uint32_t rects;         // Number of rectangles pushed to the panel
+  uint64_t cellsDrawn;    // Number of character cells rasterised
+  uint64_t pixelsPushed;  // Number of pixels pushed to the panel
+};
+
+/// @brief Print backend that renders text into RGB565 pixels. See the top of this file for details.
+template <class Panel>
+class MinuPixelRenderer
+{
+
+public:
+  /// @brief Class constructor
+  /// @param panel  Destination of the rendered pixels
+  /// @param cols   Number of characters per row
+  /// @param rows   Number of rows
+  /// @param scale  Integer factor by which the font is enlarged
+  /// @param tiled  Whether to keep only one row of text in RAM rather than the whole framebuffer
+  /// @param font   Font used to draw the text
+  MinuPixelRenderer(const Panel &panel, uint16_t cols, uint16_t rows, uint8_t scale = 1, bool tiled = false,
+                    const MinuFont &font = MINU_FONT_6X8)
+      : _panel(panel), _next(cols, rows), _shown(cols, rows), _font(font)
+  {
+    // Glyph rows are enlarged in a 64-bit accumulator, which limits each bit to 32 pixels
+    this->_scale = (scale) ? ((scale > 32) ? 32 : scale) : 1;
+    this->_cellWidth = this->_font.width * this->_scale;
+    this->_cellHeight = this->_font.height * this->_scale;
+    this->_width = cols * this->_cellWidth;
+    this->_height = rows * this->_cellHeight;
+    this->_tiled = tiled;
+    this->_pixels.resize((size_t)this->_width * ((tiled) ? this->_cellHeight : this->_height));
+    this->_mergeGap = MINU_PIXEL_MERGE_GAP_DEFAULT;
+    this->_swapBytes = false;
+    this->resetStats();
+    this->invalidate();
+  }
+
+  /// @brief Start a frame. A full frame is laid out on a blank grid, a partial one on top of the frame shown
+  void begin(bool partial)
+  {
+    if (!partial)
+      this->_next.clear();
+    this->_writer.home();
+  }
+
+  bool moveTo(uint16_t col, uint16_t row)
+  {
+    this->_writer.moveTo(col, row);
+    return true;
+  }
+
+  void print(const char *msg, uint16_t len, uint16_t fore, uint16_t back)
+  {
+    this->_writer.write(this->_next, msg, len, fore, back, false);
+  }
+
+  void printInverted(const char *msg, uint16_t len, uint16_t fore, uint16_t back)
+  {
+    this->_writer.write(this->_next, msg, len, fore, back, true);
+  }
+
+  /// @brief Draw and push the cells that changed since the previous frame
+  void flush(void)
+  {
+    this->_rects.clear();
+    this->_prevRowBegin = 0;
+    for (uint16_t r = 0; r < this->_next.rows(); ++r)
+      this->_flushRow(r);
+
+    // With a full framebuffer, rectangles are only pushed once every row has been drawn,
+    // so that identical spans on consecutive rows can be pushed as one
+    if (!this->_tiled)
+    {
+      for (size_t i = 0; i < this->_rects.size(); ++i)
+      {
+        const Rect &rc = this->_rects[i];
+        this->_push(rc.x, rc.y, rc.w, rc.h, &this->_pixels[(size_t)rc.y * this->_width + rc.x]);
+      }
+    }
+
+    this->_shown.copyFrom(this->_next);
+    this->_stats.frames++;
+  }
+
+  /// @brief Force every cell to be redrawn on the next flush, e.g. after the panel was cleared by other code
+  void invalidate(void)
+  {
+    // No character printed by a Minu is a NUL, so every cell will compare as changed
+    this->_shown.clear();
+    for (uint16_t r = 0; r < this->_shown.rows(); ++r)
+      for (uint16_t c = 0; c < this->_shown.cols(); ++c)
+        this->_shown.at(c, r).ch = 0;
+  }
+
+  /// @brief Set the maximum number of unchanged cells between two changed ones for both to share a rectangle
+  /// @note  Pushing a few extra pixels is usually cheaper than the overhead of starting another transfer
+  void setMergeGap(uint8_t cells) { this->_mergeGap = cells; }
+
+  /// @brief Set whether colours are byte-swapped before being written, for panels expecting big-endian RGB565
+  void setSwapBytes(bool swap) { this->_swapBytes = swap; }
+
+  /// @brief Returns a reference to the panel
+  Panel &panel() { return this->_panel; }
+
+#ifdef MINU_PALETTE
+  /// @brief Returns the palette cells are drawn with
+  /// @note  Cells are only redrawn when they change, so call invalidate() after changing colours in use
+  MinuPalette &palette() { return this->_palette; }
+#endif
+
+  /// @brief Returns the full framebuffer, or NULL if the renderer is tiled
+  const uint16_t *framebuffer() const { return (this->_tiled) ? NULL : this->_pixels.data(); }
+
+  /// @brief Returns the width of the rendered area in pixels
+  uint16_t width() const { return this->_width; }
+
+  /// @brief Returns the height of the rendered area in pixels
+  uint16_t height() const { return this->_height; }
+
+  /// @brief Returns the work done since the last call to resetStats()
+  const MinuPixelStats &stats() const { return this->_stats; }
+
+  void resetStats(void) { memset(&this->_stats, 0, sizeof(this->_stats)); }
+
+  /// @brief Returns the RAM used by the copies of the frame and the pixel buffers
+  /// @note  A full framebuffer counts as a cache, while a tile only exists to be pushed and counts as scratch
+  MinuMemoryUsage memoryUsage() const
+  {
+    MinuMemoryUsage usage;
+    size_t pixels = this->_pixels.capacity() * sizeof(uint16_t);
+    usage.caches = this->_next.memoryUsage() + this->_shown.memoryUsage() + ((this->_tiled) ? 0 : pixels);
+    usage.scratch = ((this->_tiled) ? pixels : 0) + this->_bits.capacity() + this->_rects.capacity() * sizeof(Rect);
+    return usage;
+  }
+
+private:
+  struct Rect
+  {
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+  };
+
+  /// @brief Draw the changed runs of cells on a text row and record or push their rectangles
+  void _flushRow(uint16_t r)
+  {
+    const MinuCell *cur = this->_next.row(r);
+    const MinuCell *old = this->_shown.row(r);
+    const uint16_t cols = this->_next.cols();
+    const uint16_t y = r * this->_cellHeight;
+    uint16_t *rowPixels = &this->_pixels[(this->_tiled) ? 0 : (size_t)y * this->_width];
+
+    // Rectangles added for the previous row, which are candidates for merging with this row's
+    size_t prevBegin = this->_prevRowBegin;
+    size_t prevEnd = this->_rects.size();
+    this->_prevRowBegin = prevEnd;
+    if (!r)
+      prevBegin = prevEnd;
+
+    uint16_t c = 0;
+    while (c < cols)
+    {
+      if (cur[c] == old[c])
+      {
+        c++;
+        continue;
+      }
+
+      // Extend the run while further changes lie within the merge gap
+      uint16_t start = c;
+      uint16_t end = c + 1;
+      for (uint16_t scan = c + 1; scan < cols && scan - end <= this->_mergeGap; ++scan)
+      {
+        if (cur[scan] != old[scan])
+          end = scan + 1;
+      }
+
+      this->_drawRun(rowPixels, cur, start, end);
+      this->_stats.cellsDrawn += end - start;
+
+      Rect rc = {(uint16_t)(start * this->_cellWidth), y, (uint16_t)((end - start) * this->_cellWidth), this->_cellHeight};
+      if (this->_tiled)
+        this->_push(rc.x, rc.y, rc.w, rc.h, rowPixels + rc.x);
+      else
+      {
+        // Grow a rectangle from the previous row with the same horizontal span, if there is one
+        bool merged = false;
+        for (size_t i = prevBegin; i < prevEnd; ++i)
+        {
+          Rect &prev = this->_rects[i];
+          if (prev.x == rc.x && prev.w == rc.w && prev.y + prev.h == rc.y)
+          {
+            prev.h += rc.h;
+            merged = true;
+            // Keep the grown rectangle visible to the next row
+            this->_rects.push_back(prev);
+            this->_rects[i].w = 0;
+            break;
+          }
+        }
+        if (!merged)
+          this->_rects.push_back(rc);
+      }
+      c = end;
+    }
+  }
+
+  /// @brief Rasterise the cells [\a start, \a end) of a text row
+  /// @param rowPixels Top-left pixel of the text row
+  void _drawRun(uint16_t *rowPixels, const MinuCell *cells, uint16_t start, uint16_t end)
+  {
+    // Cells are drawn in segments sharing a colour pair, so that each row of pixels in a segment is a single kernel call
+    uint16_t seg = start;
+    while (seg < end)
+    {
+      uint16_t segEnd = seg + 1;
+      bool blank = this->_isBlank(cells[seg].ch);
+      while (segEnd < end && cells[segEnd].fore == cells[seg].fore && cells[segEnd].back == cells[seg].back)
+      {
+        blank = blank && this->_isBlank(cells[segEnd].ch);
+        segEnd++;
+      }
+      this->_drawSegment(rowPixels + seg * this->_cellWidth, cells + seg, segEnd - seg, blank);
+      seg = segEnd;
+    }
+  }
+
+  /// @brief Rasterise \a count cells sharing the same colours, with the top-left pixel at \a dst
+  /// @param blank Whether none of the cells' glyphs have any pixels set, so that they can simply be filled
+  void _drawSegment(uint16_t *dst, const MinuCell *cells, uint16_t count, bool blank)
+  {
+#ifdef MINU_PALETTE
+    uint16_t fore = this->_palette.colour(cells[0].fore);
+    uint16_t back = this->_palette.colour(cells[0].back);
+#else
+    uint16_t fore = cells[0].fore;
+    uint16_t back = cells[0].back;
+#endif
+    if (this->_swapBytes)
+    {
+      fore = (fore >> 8) | (fore << 8);
+      back = (back >> 8) | (back << 8);
+    }
+
+    const size_t stride = this->_width;
+    const size_t span = (size_t)count * this->_cellWidth;
+    if (blank)
+    {
+      for (uint16_t y = 0; y < this->_cellHeight; ++y)
+        minuFill565(dst + y * stride, span, back);
+      return;
+    }
+
+    this->_bits.resize((span + 7) / 8 + 1);
+    for (uint8_t gy = 0; gy < this->_font.height; ++gy)
+    {
+      this->_packGlyphRow(cells, count, gy);
+      uint16_t *line = dst + (size_t)gy * this->_scale * stride;
+      minuExpandBits(line, this->_bits.data(), span, fore, back);
+
+      // Enlarged glyphs repeat each row of pixels
+      for (uint8_t s = 1; s < this->_scale; ++s)
+        memcpy(line + s * stride, line, span * sizeof(uint16_t));
+    }
+  }
+
+  /// @brief Concatenate one row of each cell's glyph into a bitstream, enlarging every bit by the scale
+  void _packGlyphRow(const MinuCell *cells, uint16_t count, uint8_t gy)
+  {
+    const uint8_t width = this->_font.width;
+    const uint8_t scale = this->_scale;
+    const uint64_t ones = ((uint64_t)1 << scale) - 1;
+    uint64_t acc = 0;
+    uint8_t accBits = 0;
+    uint8_t *out = this->_bits.data();
+
+    for (uint16_t i = 0; i < count; ++i)
+    {
+      uint8_t row = this->_font.glyph(cells[i].ch)[gy];
+      for (uint8_t x = 0; x < width; ++x)
+      {
+        acc = (acc << scale) | ((row & (0x80 >> x)) ? ones : 0);
+        accBits += scale;
+        while (accBits >= 8)
+        {
+          accBits -= 8;
+          *out++ = acc >> accBits;
+        }
+      }
+    }
+    if (accBits)
+      *out = acc << (8 - accBits);
+  }
+
+  /// @brief Whether the glyph of the given character has no pixels set
+  bool _isBlank(char c) const
+  {
+    const uint8_t *glyph = this->_font.glyph(c);
+    for (uint8_t gy = 0; gy < this->_font.height; ++gy)
+      if (glyph[gy])
+        return false;
+    return true;
+  }
+
+  void _push(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *pixels)
+  {
+    if (!w || !h)
+      return;
+    this->_panel.pushRect(x, y, w, h, pixels, this->_width);
+    this->_stats.rects++;
+    this->_stats.pixelsPushed += (uint32_t)w * h;
+  }
+
+  Panel _panel;
+  MinuCellGrid _next;
+  MinuCellGrid _shown;
+  MinuGridWriter _writer;
+  MinuFont _font;
+#ifdef MINU_PALETTE
+  MinuPalette _palette;
+#endif
+  std::vector<uint16_t> _pixels;
+  std::vector<uint8_t> _bits;
+  std::vector<Rect> _rects;
+  size_t _prevRowBegin;
+  uint8_t _scale;
+  uint16_t _cellWidth;
+  uint16_t _cellHeight;
+  uint16_t _width;
+  uint16_t _height;
+  bool _tiled;
+  uint8_t _mergeGap;
+  bool _swapBytes;
+  MinuPixelStats _stats;
+};
+
+/// @brief Panel that keeps the pushed pixels in memory.
+/// @note  Useful on a host to measure the pixels touched per frame and to compare the output with golden images.
+class MinuMemoryPanel
+{
+
+public:
+  MinuMemoryPanel(uint16_t width = 0, uint16_t height = 0)
+  {
+    this->_width = width;
+    this->_height = height;
+    this->_pixels.assign((size_t)width * height, 0);
+  }
+
+  void pushRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *pixels, size_t stride)
+  {
+    for (uint16_t row = 0; row < h; ++row)
+    {
+      if (y + row >= this->_height)
+        break;
+      uint16_t copy = (x + w > this->_width) ? ((x < this->_width) ? this->_width - x : 0) : w;
+      memcpy(&this->_pixels[(size_t)(y + row) * this->_width + x], pixels + (size_t)row * stride, copy * sizeof(uint16_t));
+    }
+  }
+
+  uint16_t width() const { return this->_width; }
+  uint16_t height() const { return this->_height; }
+
+  /// @brief Returns the panel's pixels, row by row
+  const uint16_t *pixels() const { return this->_pixels.data(); }
+
+  /// @brief Returns the colour of the given pixel
+  uint16_t pixel(uint16_t x, uint16_t y) const { return this->_pixels[(size_t)y * this->_width + x]; }
+
+  /// @brief Returns a 32-bit FNV-1a hash of the panel's pixels, for cheap comparison against a known value
+  uint32_t checksum() const
+  {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < this->_pixels.size(); ++i)
+    {
+      hash = (hash ^ (this->_pixels[i] & 0xFF)) * 16777619u;
+      hash = (hash ^ (this->_pixels[i] >> 8)) * 16777619u;
+    }
+    return hash;
+  }
+
+  /// @brief  Save the panel's pixels as a binary PPM image
+  /// @return false, if the file could not be written
+  bool writePpm(const char *path) const
+  {
+    FILE *f = fopen(path, "wb");
+    if (!f)
+      return false;
+
+    fprintf(f, "P6\n%u %u\n255\n", this->_width, this->_height);
+    for (size_t i = 0; i < this->_pixels.size(); ++i)
+    {
+      uint8_t rgb[3];
+      _toRgb888(this->_pixels[i], rgb);
+      fwrite(rgb, 1, 3, f);
+    }
+    return fclose(f) == 0;
+  }
+
+  /// @brief  Compare the panel's pixels with a binary PPM image, e.g. one previously saved with writePpm()
+  /// @return Number of pixels that differ, or -1 if the image could not be read or has different dimensions
+  ssize_t comparePpm(const char *path) const
+  {
+    FILE *f = fopen(path, "rb");
+    if (!f)
+      return -1;
+
+    unsigned w, h, maxval;
+    if (fscanf(f, "P6 %u %u %u", &w, &h, &maxval) != 3 || w != this->_width || h != this->_height || maxval != 255)
+    {
+      fclose(f);
+      return -1;
+    }
+    fgetc(f);
+
+    ssize_t mismatches = 0;
+    for (size_t i = 0; i < this->_pixels.size(); ++i)
+    {
+      uint8_t expected[3], actual[3];
+      if (fread(expected, 1, 3, f) != 3)
+      {
+        fclose(f);
+        return -1;
+      }
+      _toRgb888(this->_pixels[i], actual);
+      if (memcmp(expected, actual, 3))
+        mismatches++;
+    }
+    fclose(f);
+    return mismatches;
+  }
+
+private:
+  static void _toRgb888(uint16_t c, uint8_t *rgb)
+  {
+    rgb[0] = ((c >> 11) & 0x1F) * 255 / 31;
+    rgb[1] = ((c >> 5) & 0x3F) * 255 / 63;
+    rgb[2] = (c & 0x1F) * 255 / 31;
+  }
+
+  uint16_t _width;
+  uint16_t _height;
+  std::vector<uint16_t> _pixels;
+};
+
+#endif
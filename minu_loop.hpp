@@ -0,0 +1,836 @@
+/*
+ * @file  minu_loop.hpp
+ * @brief Event loop that sleeps until a Minu has input to process, an update is due or a render is requested.
+ *
+ * Input is posted to the loop from any task (or interrupt, on the ESP32) with post(), and the loop task only
+ * wakes up to handle it. How the loop task sleeps and is woken is defined by a waiter class:
+ *
+ *   - MinuTaskNotifyWaiter  FreeRTOS task notifications (ESP32)
+ *   - MinuConditionWaiter   std::condition_variable (any hosted platform)
+ *   - MinuEventFdWaiter     Linux eventfd, whose descriptor can also be added to an external poll()/epoll set
+ *
+ * A waiter provides attach(), called from the loop task before it first waits, wait(timeoutMs), which returns
+ * when notified or after the timeout, and notify(). Notifications are not lost if they arrive before wait().
+ */
+
+#ifndef _LIBMINU_LOOP_H_
+#define _LIBMINU_LOOP_H_
+
+#include <stdint.h>
+#include <atomic>
+
+#include "minu.hpp"
+#include "minu_queue.hpp"
+#include "minu_deferred.hpp"
+#include "minu_action.hpp"
+#include "minu_timer.hpp"
+#include "minu_stack.hpp"
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#else
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#endif
+
+#ifdef __linux__
+#include <poll.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#endif
+
+#define MINU_WAIT_FOREVER           0xFFFFFFFF  // Timeout used to wait until notified
+#define MINU_LOOP_QUEUE_LEN         16          // Maximum number of input events pending
+
+#define MINU_LOOP_REPEAT_DELAY_DEFAULT         400  // Time an input is held before it starts repeating
+#define MINU_LOOP_REPEAT_INTERVAL_DEFAULT      150  // Interval between the first repeats of a held input
+#define MINU_LOOP_REPEAT_MIN_INTERVAL_DEFAULT  40   // Interval the repeats speed up to
+#define MINU_LOOP_REPEAT_STEP_MAX              16   // Maximum number of items moved by each repeat
+#define MINU_LOOP_REPEAT_STEP_AFTER            4    // Number of repeats at the fastest interval before the step doubles
+
+// Define MINU_LOOP_STACK_PROBE to have the loop measure the stack used by rendering and by callbacks with a pair of
+// MinuStackProbe (minu_stack.hpp). Each iteration then paints MINU_STACK_PROBE_DEPTH bytes of stack twice, so the
+// loop task needs that much more stack than it otherwise would
+
+/// @brief Navigation events handled by the event loop
+/// @note  Values from MINU_INPUT_USER onwards may be used for application-defined events
+enum MinuInputEvent
+{
+  MINU_INPUT_NONE = 0,
+  MINU_INPUT_NEXT,      // Highlight the next item of the current page
+  MINU_INPUT_PREVIOUS,  // Highlight the previous item of the current page
+  MINU_INPUT_SELECT,    // Call the link of the current page's highlighted item
+  MINU_INPUT_RELEASE,   // Stop repeating a held input
+  MINU_INPUT_HELD = 0x40, // Flag combined with NEXT or PREVIOUS to keep repeating it, faster and faster, until RELEASE
+  MINU_INPUT_USER = 0x80,
+};
+
+/// @brief       Function given the chance to handle an input event before the event loop does
+/// @param event Event posted to the loop
+/// @param arg   User-defined argument registered along with the function
+/// @return      true, if the event was handled and the default handling should be skipped
+typedef bool (*MinuInputHandler)(uint8_t event, void *arg);
+
+/// @brief Clock based on the platform's millisecond counter
+class MinuSystemClock
+{
+
+public:
+  /// @brief Returns the number of milliseconds elapsed since an arbitrary point, wrapping at 2^32
+  uint32_t now(void)
+  {
+#ifdef ARDUINO
+    return millis();
+#else
+    return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+  }
+};
+
+#ifdef ESP_PLATFORM
+/// @brief Waiter that blocks the loop task on its FreeRTOS task notification
+class MinuTaskNotifyWaiter
+{
+
+public:
+  MinuTaskNotifyWaiter() { this->_task = NULL; }
+
+  void attach(void) { this->_task = xTaskGetCurrentTaskHandle(); }
+
+  void wait(uint32_t timeoutMs)
+  {
+    TickType_t ticks = portMAX_DELAY;
+    if (timeoutMs != MINU_WAIT_FOREVER)
+    {
+      // Round up so that a short timeout does not become a zero-tick poll
+      ticks = pdMS_TO_TICKS(timeoutMs);
+      if (!ticks && timeoutMs)
+        ticks = 1;
+    }
+    ulTaskNotifyTake(pdTRUE, ticks);
+  }
+
+  /// @note Safe to call from an interrupt
+  void notify(void)
+  {
+    TaskHandle_t task = this->_task;
+    if (!task)
+      return;
+
+    if (xPortInIsrContext())
+    {
+      BaseType_t woken = pdFALSE;
+      vTaskNotifyGiveFromISR(task, &woken);
+      if (woken)
+        portYIELD_FROM_ISR();
+    }
+    else
+      xTaskNotifyGive(task);
+  }
+
+private:
+  TaskHandle_t _task;
+};
+
+typedef MinuTaskNotifyWaiter MinuDefaultWaiter;
+
+#else
+/// @brief Waiter that blocks the loop thread on a condition variable
+class MinuConditionWaiter
+{
+
+public:
+  MinuConditionWaiter() { this->_signalled = false; }
+
+  void attach(void) {}
+
+  void wait(uint32_t timeoutMs)
+  {
+    std::unique_lock<std::mutex> lock(this->_mutex);
+    if (timeoutMs == MINU_WAIT_FOREVER)
+      this->_cond.wait(lock, [this] { return this->_signalled; });
+    else
+      this->_cond.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this] { return this->_signalled; });
+    this->_signalled = false;
+  }
+
+  void notify(void)
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->_mutex);
+      this->_signalled = true;
+    }
+    this->_cond.notify_one();
+  }
+
+private:
+  std::mutex _mutex;
+  std::condition_variable _cond;
+  bool _signalled;
+};
+
+typedef MinuConditionWaiter MinuDefaultWaiter;
+#endif
+
+#ifdef __linux__
+/// @brief Waiter that blocks the loop thread on a Linux eventfd
+/// @note  notify() only writes to the descriptor, so it is also safe to call from a signal handler
+class MinuEventFdWaiter
+{
+
+public:
+  MinuEventFdWaiter() { this->_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK); }
+  ~MinuEventFdWaiter()
+  {
+    if (this->_fd >= 0)
+      close(this->_fd);
+  }
+
+  void attach(void) {}
+
+  void wait(uint32_t timeoutMs)
+  {
+    struct pollfd pfd = {this->_fd, POLLIN, 0};
+    if (poll(&pfd, 1, (timeoutMs == MINU_WAIT_FOREVER) ? -1 : (int)timeoutMs) > 0)
+    {
+      uint64_t count;
+      if (read(this->_fd, &count, sizeof(count)) < 0)
+        return;
+    }
+  }
+
+  void notify(void)
+  {
+    uint64_t one = 1;
+    if (write(this->_fd, &one, sizeof(one)) < 0)
+      return;
+  }
+
+  /// @brief Returns the descriptor that becomes readable when notified
+  int fd() const { return this->_fd; }
+
+private:
+  MinuEventFdWaiter(const MinuEventFdWaiter &);
+  MinuEventFdWaiter &operator=(const MinuEventFdWaiter &);
+
+  int _fd;
+};
+#endif
+
+/// @brief Runs a Minu from a single task, sleeping whenever there is nothing to do.
+/// @note  post(), requestRender() and stop() may be called from any task. Every other member, and every
+///        callback invoked by the loop, runs on the loop task.
+template <class Backend = MinuFunctionBackend, class Waiter = MinuDefaultWaiter, class Clock = MinuSystemClock>
+class MinuEventLoop
+{
+
+public:
+  /// @brief Class constructor
+  /// @param menu        Menu driven by the loop
+  /// @param renderCount Maximum number of items to render, passed to MinuBasic::render()
+  MinuEventLoop(MinuBasic<Backend> &menu, uint16_t renderCount) : _menu(menu)
+  {
+    this->_renderCount = renderCount;
+    this->_renderRequested.store(true);
+    this->_running.store(false);
+    this->_inputHandler = NULL;
+    this->_inputHandlerArg = NULL;
+    this->_preRenderCallback = NULL;
+    this->_preRenderArg = NULL;
+    this->_lastPage = -1;
+    this->_lastHighlightedIndex = -1;
+    this->_deferred = NULL;
+    this->_skipWait = false;
+    this->_attached = false;
+    this->_settleMs = 0;
+    this->_settleHandle = -1;
+    this->_pendingHighlightPage = -1;
+    this->_repeatHandle = -1;
+    this->_openPage = -1;
+    this->_releaseDelayMs = 0;
+    this->_releaseHandle = -1;
+    this->_renderBudgetMs = 0;
+    this->_renderBudgetBytes = 0;
+    this->_sliceDeadline = 0;
+    this->setAutoRepeat(MINU_LOOP_REPEAT_DELAY_DEFAULT, MINU_LOOP_REPEAT_INTERVAL_DEFAULT,
+                        MINU_LOOP_REPEAT_MIN_INTERVAL_DEFAULT);
+#ifdef MINU_HAS_ACTIONS
+    this->_actions.setNotifyFunction(_notify, this);
+    this->_actions.setPageIdFunction(_currentPageId, this);
+    this->_actions.setTimeFunction(_currentTime, this);
+#endif
+    this->_timers.begin(this->_clock.now());
+  }
+
+  /// @brief  Queue an input event and wake the loop
+  /// @return false, if the event queue is full and the event was discarded
+  bool post(uint8_t event)
+  {
+    bool queued = this->_events.push(event);
+    this->_waiter.notify();
+    return queued;
+  }
+
+  /// @brief Ask the loop to render the menu as soon as possible, e.g. after changing an item from another task
+  void requestRender(void)
+  {
+    this->_renderRequested.store(true);
+    this->_waiter.notify();
+  }
+
+  /// @brief  Publish a batch of page changes from any task, and have the loop render them
+  /// @return false, if the transaction has no changes
+  bool commit(const MinuTransaction &transaction)
+  {
+    if (!this->_menu.commit(transaction))
+      return false;
+    this->requestRender();
+    return true;
+  }
+
+  /// @brief  Set an item's status from any task or interrupt. See MinuPageItem::setStatus()
+  /// @note   The loop is only woken by the first change since the item was last rendered, so frequent updates
+  ///         are coalesced into a single render
+  /// @return true, if the loop was woken
+  bool setStatus(MinuPageItem &item, uint8_t state, uint16_t fore, uint16_t back)
+  {
+    if (!item.setStatus(state, fore, back))
+      return false;
+    this->_waiter.notify();
+    return true;
+  }
+
+  /// @brief Render the menu immediately
+  /// @note  Only call from the loop task, e.g. from an item link that needs the screen updated before it proceeds
+  void renderNow(void)
+  {
+    this->_renderRequested.store(false);
+    if (this->_preRenderCallback)
+      this->_preRenderCallback(this->_preRenderArg);
+    this->_menu.render(this->_renderCount);
+    this->_frameRendered();
+  }
+
+  /// @brief Split renders into slices, so that input is handled between the slices of a frame that takes long to print
+  /// @param ms    Time after which a slice stops printing, or 0 for no limit. At least one row is printed per slice
+  /// @param bytes Number of characters after which a slice stops printing, or 0 for no limit
+  /// @note  With both set to 0, the default, each frame is rendered in one go. Otherwise frames are rendered with
+  ///        MinuBasic::renderPart(), title and highlighted item first, and the loop runs the next slice without
+  ///        sleeping. A frame that no longer matches the menu, e.g. because the highlight moved, is started over,
+  ///        with the pre-render callback called again, and one that the menu changed under is followed by another
+  /// @note  renderNow() still renders whole frames
+  void setRenderBudget(uint32_t ms, size_t bytes = 0)
+  {
+    this->_renderBudgetMs = ms;
+    this->_renderBudgetBytes = bytes;
+  }
+
+  /// @brief Set a function given the chance to handle each input event first
+  void setInputHandler(MinuInputHandler handler, void *arg = NULL)
+  {
+    this->_inputHandler = handler;
+    this->_inputHandlerArg = arg;
+  }
+
+  /// @brief Set a function to be called just before each render, e.g. to clear the display
+  void setPreRenderCallback(MinuCallbackFunction cb, void *arg = NULL)
+  {
+    this->_preRenderCallback = cb;
+    this->_preRenderArg = arg;
+  }
+
+  /// @brief Set how long the highlight has to rest on an item before the item's highlighted callback is called
+  /// @param settleMs Time without further NEXT or PREVIOUS inputs, or 0 to call it once the pending inputs are handled
+  /// @note  Either way, a burst of inputs or a held input only calls the callback of the item it ends on
+  void setHighlightSettleTime(uint32_t settleMs) { this->_settleMs = settleMs; }
+
+  /// @brief Set how NEXT and PREVIOUS inputs posted with MINU_INPUT_HELD repeat until MINU_INPUT_RELEASE is posted
+  /// @param delayMs       Time before the first repeat
+  /// @param intervalMs    Interval between the first repeats, which shrinks by a quarter with each repeat
+  /// @param minIntervalMs Shortest interval. Once reached, the number of items moved doubles every
+  ///                      MINU_LOOP_REPEAT_STEP_AFTER repeats, up to MINU_LOOP_REPEAT_STEP_MAX
+  void setAutoRepeat(uint32_t delayMs, uint32_t intervalMs, uint32_t minIntervalMs)
+  {
+    this->_repeatDelayMs = delayMs;
+    this->_repeatIntervalMs = intervalMs;
+    this->_repeatMinIntervalMs = (minIntervalMs) ? minIntervalMs : 1;
+  }
+
+  /// @brief Set how long a page with a builder stays built once it is closed, after which its items are freed
+  /// @param delayMs Time since the page was closed, or 0 to keep pages built until MinuBasic::releasePages() is called
+  /// @note  See MinuBasic::addLazyPage()
+  void setPageReleaseDelay(uint32_t delayMs) { this->_releaseDelayMs = delayMs; }
+
+  /// @brief Defer the menu's navigation callbacks until the loop has rendered the result of each input
+  /// @param deferred Queue the callbacks are recorded in, or NULL to call them immediately again
+  /// @note  Anything the callbacks change is rendered straight after they run. Callbacks queued by other tasks
+  ///        wake the loop
+  void setDeferredCallbacks(MinuDeferredCallbacks *deferred)
+  {
+    this->_deferred = deferred;
+    this->_menu.setCallbackDispatcher(deferred);
+    if (deferred)
+      deferred->setNotifyFunction(_notify, this);
+  }
+
+#ifdef MINU_HAS_ACTIONS
+  /// @brief  Start a coroutine action on the loop, running it until it first suspends. See minu_action.hpp
+  /// @note   Only call from the loop task, e.g. from an item link
+  /// @return false, if too many actions are already running
+  bool startAction(MinuAction action)
+  {
+    bool started = this->_actions.start(static_cast<MinuAction &&>(action), this->_clock.now(),
+                                        this->_menu.currentPageId());
+    this->_skipWait = true;
+    return started;
+  }
+
+  /// @brief Returns the runner of the loop's actions
+  MinuActionRunner &actions() { return this->_actions; }
+#endif
+
+  /// @brief  Register a function to be called periodically from the loop
+  /// @param  periodMs Interval between calls
+  /// @param  cb       Function to call
+  /// @param  arg      Argument passed to \a cb
+  /// @param  slackMs  Time by which each call may be late, so that it can be made together with other updates
+  /// @return Handle used to remove the update, or -1 if no timers are free
+  ssize_t addPeriodic(uint32_t periodMs, MinuCallbackFunction cb, void *arg = NULL, uint32_t slackMs = 0)
+  {
+    if (!periodMs)
+      return -1;
+    return this->_timers.add(this->_clock.now(), periodMs, periodMs, slackMs, cb, arg);
+  }
+
+  /// @brief  Register a function to be called periodically from the loop while a page is the current page
+  /// @param  pageId   Page the update belongs to. The update is removed once another page becomes current
+  /// @param  periodMs Interval between calls
+  /// @param  cb       Function to call
+  /// @param  arg      Argument passed to \a cb
+  /// @param  slackMs  Time by which each call may be late, so that it can be made together with other updates
+  /// @return Handle used to remove the update early, or -1 if no timers are free
+  /// @note   Typically called from the page's opened callback
+  ssize_t addPageUpdater(size_t pageId, uint32_t periodMs, MinuCallbackFunction cb, void *arg = NULL,
+                         uint32_t slackMs = 0)
+  {
+    if (!periodMs)
+      return -1;
+    return this->_timers.add(this->_clock.now(), periodMs, periodMs, slackMs, cb, arg, pageId);
+  }
+
+  /// @brief  Register a function to be called once from the loop
+  /// @param  delayMs Time until the call
+  /// @param  cb      Function to call
+  /// @param  arg     Argument passed to \a cb
+  /// @return Handle used to cancel the call, or -1 if no timers are free
+  ssize_t addTimeout(uint32_t delayMs, MinuCallbackFunction cb, void *arg = NULL)
+  {
+    return this->_timers.add(this->_clock.now(), delayMs, 0, 0, cb, arg);
+  }
+
+  /// @brief  Register a function to be called once from the loop, unless another page becomes current first
+  /// @param  pageId  Page the call belongs to
+  /// @param  delayMs Time until the call
+  /// @param  cb      Function to call
+  /// @param  arg     Argument passed to \a cb
+  /// @return Handle used to cancel the call, or -1 if no timers are free
+  /// @note   A call that re-registers itself with a delay of its choosing, e.g. until the next second starts, makes
+  ///         an updater whose period varies
+  ssize_t addPageTimeout(size_t pageId, uint32_t delayMs, MinuCallbackFunction cb, void *arg = NULL)
+  {
+    return this->_timers.add(this->_clock.now(), delayMs, 0, 0, cb, arg, pageId);
+  }
+
+  /// @brief Stop calling a periodic update or page updater, or cancel a timeout
+  /// @param handle Handle returned by addPeriodic(), addPageUpdater(), addTimeout() or addPageTimeout()
+  void removeTimer(ssize_t handle) { this->_timers.remove(handle); }
+
+  /// @brief  Sleep until there is work to do, then do it
+  /// @param  maxWaitMs Maximum time to sleep, regardless of whether there is work
+  /// @return true, if the whole menu was rendered
+  /// @note   The first call attaches the waiter to the calling task, so that notifications wake it. A loop driven by
+  ///         runOnce() from another task than before must call waiter().attach() from the new task
+  bool runOnce(uint32_t maxWaitMs = MINU_WAIT_FOREVER)
+  {
+    if (!this->_attached)
+    {
+      this->_waiter.attach();
+      this->_attached = true;
+    }
+
+    uint32_t timeout = this->_nextDeadline();
+    if (timeout > maxWaitMs)
+      timeout = maxWaitMs;
+    if (timeout && !this->_skipWait && this->_events.empty() && !this->_renderRequested.load())
+      this->_waiter.wait(timeout);
+    this->_skipWait = false;
+
+#ifdef MINU_LOOP_STACK_PROBE
+    this->_callbackProbe.paint();
+#endif
+    this->_processEvents();
+    this->_timers.setVisiblePage(this->_menu.currentPageId());
+    this->_timers.advance(this->_clock.now());
+#ifdef MINU_HAS_ACTIONS
+    // Actions awaiting the next frame have usually just changed something, which the loop cannot see
+    this->_actions.poll(this->_clock.now(), this->_menu.currentPageId());
+    if (this->_actions.waitingForFrame())
+      this->_renderRequested.store(true);
+#endif
+    this->_trackOpenPage();
+#ifdef MINU_LOOP_STACK_PROBE
+    this->_callbackProbe.measure();
+    this->_renderProbe.paint();
+#endif
+    bool rendered = this->_render();
+#ifdef MINU_LOOP_STACK_PROBE
+    this->_renderProbe.measure();
+    this->_callbackProbe.paint();
+#endif
+
+    // Deferred callbacks only run once the result of the input is on screen. Since they may well change what
+    // should be displayed, the next iteration checks for changes without waiting
+    if (this->_deferred && this->_deferred->runPending())
+      this->_skipWait = true;
+#ifdef MINU_LOOP_STACK_PROBE
+    this->_callbackProbe.measure();
+#endif
+    return rendered;
+  }
+
+  /// @brief Run the loop on the calling task until stop() is called
+  void run(void)
+  {
+    this->_waiter.attach();
+    this->_attached = true;
+    this->_running.store(true);
+    while (this->_running.load())
+      this->runOnce();
+  }
+
+  /// @brief Make run() return once the current iteration completes
+  void stop(void)
+  {
+    this->_running.store(false);
+    this->_waiter.notify();
+  }
+
+  /// @brief Returns a reference to the waiter, e.g. to integrate it with another event source
+  Waiter &waiter() { return this->_waiter; }
+
+  /// @brief Returns a reference to the clock
+  Clock &clock() { return this->_clock; }
+
+#ifdef MINU_LOOP_STACK_PROBE
+  /// @brief Returns the probe measuring the stack used by rendering, measured from runOnce()
+  const MinuStackProbe &renderStack() const { return this->_renderProbe; }
+
+  /// @brief Returns the probe measuring the stack used by links, updaters, actions and deferred callbacks
+  const MinuStackProbe &callbackStack() const { return this->_callbackProbe; }
+#endif
+
+private:
+  /// @brief  Render the menu if anything changed
+  /// @return true, if the whole menu was rendered
+  bool _render(void)
+  {
+    MinuPage *page = this->_menu.currentPage();
+    bool changed = this->_menu.currentPageId() != this->_lastPage ||
+                   (page && page->highlightedIndex() != this->_lastHighlightedIndex);
+    if (!changed && !this->_menu.frameInProgress() && this->_menu.rendered() && !this->_renderRequested.load() &&
+        !this->_menu.statusChanged())
+    {
+      // Changes to an info page's canvas are printed in place, falling back to rendering the whole page
+      if (!this->_menu.canvas().dirty() || this->_menu.renderCanvas())
+        return false;
+    }
+
+    if (!this->_renderBudgetMs && !this->_renderBudgetBytes)
+    {
+      this->renderNow();
+      return true;
+    }
+
+    // A slice of the frame is printed. The pre-render callback only runs when a frame is started, since the slices
+    // before would be cleared otherwise
+    if (!this->_menu.resumable())
+    {
+      this->_renderRequested.store(false);
+      if (this->_preRenderCallback)
+        this->_preRenderCallback(this->_preRenderArg);
+    }
+    this->_sliceDeadline = this->_clock.now() + this->_renderBudgetMs;
+    if (!this->_menu.renderPart(this->_renderCount, this->_renderBudgetBytes,
+                                (this->_renderBudgetMs) ? _sliceExpired : NULL, this))
+    {
+      this->_skipWait = true;
+      return false;
+    }
+    this->_frameRendered();
+    return true;
+  }
+
+  /// @brief Note that a whole frame is on screen
+  void _frameRendered(void)
+  {
+#ifdef MINU_HAS_ACTIONS
+    this->_actions.frameRendered();
+#endif
+    this->_lastPage = this->_menu.currentPageId();
+    this->_lastHighlightedIndex = (this->_menu.currentPage()) ? this->_menu.currentPage()->highlightedIndex() : -1;
+  }
+
+  /// @brief Whether the time budget of the slice being rendered is used up
+  static bool _sliceExpired(void *arg)
+  {
+    MinuEventLoop *loop = (MinuEventLoop *)arg;
+    return (int32_t)(loop->_clock.now() - loop->_sliceDeadline) >= 0;
+  }
+
+  /// @brief Note when the current page changes, and schedule the release of the page that was closed
+  void _trackOpenPage(void)
+  {
+    ssize_t id = this->_menu.currentPageId();
+    if (id == this->_openPage)
+      return;
+
+    if (this->_openPage >= 0 && (size_t)this->_openPage < this->_menu.numPages())
+    {
+      MinuPage *closed = this->_menu.pages()[this->_openPage];
+      closed->setClosedTime(this->_clock.now());
+      if (closed->lazy() && this->_releaseDelayMs && this->_releaseHandle < 0)
+        this->_releaseHandle = this->addTimeout(this->_releaseDelayMs, _releasePages, this);
+    }
+    this->_openPage = id;
+  }
+
+  /// @brief Free the pages closed for longer than the release delay, and wait for the next one to be
+  static void _releasePages(void *arg)
+  {
+    MinuEventLoop *loop = (MinuEventLoop *)arg;
+    loop->_releaseHandle = -1;
+    if (!loop->_releaseDelayMs)
+      return;
+
+    uint32_t now = loop->_clock.now();
+    loop->_menu.releasePages(now, loop->_releaseDelayMs);
+
+    uint32_t next = MINU_WAIT_FOREVER;
+    std::vector<MinuPage *> pages = loop->_menu.pages();
+    for (size_t i = 0; i < pages.size(); ++i)
+    {
+      if ((ssize_t)i == loop->_menu.currentPageId() || !pages[i]->lazy() || !pages[i]->built())
+        continue;
+      uint32_t remaining = loop->_releaseDelayMs - (now - pages[i]->closedTime());
+      if (remaining < next)
+        next = remaining;
+    }
+    if (next != MINU_WAIT_FOREVER)
+      loop->_releaseHandle = loop->addTimeout(next, _releasePages, loop);
+  }
+
+  /// @brief Wakes the loop when a deferred callback is queued
+  static void _notify(void *arg) { ((MinuEventLoop *)arg)->_waiter.notify(); }
+
+  static ssize_t _currentPageId(void *arg) { return ((MinuEventLoop *)arg)->_menu.currentPageId(); }
+
+  static uint32_t _currentTime(void *arg) { return ((MinuEventLoop *)arg)->_clock.now(); }
+
+  /// @brief Returns the number of milliseconds until the next timer or action is due
+  uint32_t _nextDeadline(void)
+  {
+    uint32_t now = this->_clock.now();
+    uint32_t timeout = this->_timers.timeout(now);
+#ifdef MINU_HAS_ACTIONS
+    uint32_t actionTimeout = this->_actions.timeout(now);
+    if (actionTimeout < timeout)
+      timeout = actionTimeout;
+#endif
+    return timeout;
+  }
+
+  void _processEvents(void)
+  {
+    uint8_t event;
+    bool handled = false;
+    while (this->_events.pop(event))
+    {
+      handled = true;
+      // Updaters of a page closed by the previous input must not survive, even if this input reopens it
+      this->_timers.setVisiblePage(this->_menu.currentPageId());
+      if (this->_inputHandler && this->_inputHandler(event, this->_inputHandlerArg))
+        continue;
+
+      MinuPage *page = this->_menu.currentPage();
+      if (!page)
+        continue;
+
+      uint8_t input = (event < MINU_INPUT_USER) ? (event & ~MINU_INPUT_HELD) : event;
+      if (input == MINU_INPUT_NEXT || input == MINU_INPUT_PREVIOUS)
+      {
+        ssize_t direction = (input == MINU_INPUT_NEXT) ? 1 : -1;
+        this->_stopRepeat();
+        this->_moveHighlight(direction);
+        if (event & MINU_INPUT_HELD)
+          this->_startRepeat(direction);
+      }
+      else if (input == MINU_INPUT_RELEASE)
+        this->_stopRepeat();
+      else if (input == MINU_INPUT_SELECT && page->highlightedIndex() >= 0 &&
+               (size_t)page->highlightedIndex() < page->getItemCount())
+      {
+        // The item being selected is highlighted for good
+        this->_settleHighlight(true);
+
+        // The link receives a copy of the item, since it may well modify or delete the page's items
+        const MinuPageItem *item = page->item(page->highlightedIndex());
+        if (item && item->link())
+        {
+          MinuPageItem highlightedItem = *item;
+          highlightedItem.link()(&highlightedItem);
+        }
+      }
+    }
+
+    // Highlighted callbacks are only called for the item the highlight ends up on
+    if (handled && this->_repeatHandle < 0)
+      this->_settleHighlight(false);
+  }
+
+  /// @brief Move the highlight without calling the highlighted callback, which is left to _settleHighlight()
+  void _moveHighlight(ssize_t steps)
+  {
+    MinuPage *page = this->_menu.currentPage();
+    if (!page || page->moveHighlight(steps, false) < 0)
+      return;
+    this->_pendingHighlightPage = this->_menu.currentPageId();
+  }
+
+  /// @brief Call the highlighted callback the highlight moves are waiting for, now or once the settle time has passed
+  void _settleHighlight(bool now)
+  {
+    this->_timers.remove(this->_settleHandle);
+    this->_settleHandle = -1;
+    if (this->_pendingHighlightPage < 0)
+      return;
+
+    // The callback of a page that has since been closed is dropped
+    if (this->_pendingHighlightPage != this->_menu.currentPageId())
+    {
+      this->_pendingHighlightPage = -1;
+      return;
+    }
+
+    if (now || !this->_settleMs)
+    {
+      this->_pendingHighlightPage = -1;
+      this->_menu.currentPage()->callHighlightedCallback();
+    }
+    else
+      this->_settleHandle = this->_timers.add(this->_clock.now(), this->_settleMs, 0, 0, _settled, this,
+                                              this->_pendingHighlightPage);
+  }
+
+  static void _settled(void *arg)
+  {
+    MinuEventLoop *loop = (MinuEventLoop *)arg;
+    loop->_settleHandle = -1;
+    loop->_settleHighlight(true);
+  }
+
+  void _startRepeat(ssize_t direction)
+  {
+    this->_repeatDirection = direction;
+    this->_repeatStep = 1;
+    this->_repeatCount = 0;
+    this->_repeatInterval = this->_repeatIntervalMs;
+    this->_repeatPage = this->_menu.currentPageId();
+    this->_repeatHandle = this->_timers.add(this->_clock.now(), this->_repeatDelayMs, 0, 0, _repeat, this);
+  }
+
+  void _stopRepeat(void)
+  {
+    if (this->_repeatHandle < 0)
+      return;
+
+    this->_timers.remove(this->_repeatHandle);
+    this->_repeatHandle = -1;
+    this->_settleHighlight(false);
+  }
+
+  static void _repeat(void *arg)
+  {
+    MinuEventLoop *loop = (MinuEventLoop *)arg;
+    loop->_repeatHandle = -1;
+
+    // A held input stops repeating once its page is closed
+    if (loop->_menu.currentPageId() != loop->_repeatPage)
+    {
+      loop->_settleHighlight(false);
+      return;
+    }
+    loop->_moveHighlight(loop->_repeatDirection * loop->_repeatStep);
+
+    // Speed up until the shortest interval is reached, then move further with each repeat
+    if (loop->_repeatInterval > loop->_repeatMinIntervalMs)
+    {
+      loop->_repeatInterval -= loop->_repeatInterval / 4;
+      if (loop->_repeatInterval < loop->_repeatMinIntervalMs)
+        loop->_repeatInterval = loop->_repeatMinIntervalMs;
+    }
+    else if (++loop->_repeatCount >= MINU_LOOP_REPEAT_STEP_AFTER && loop->_repeatStep < MINU_LOOP_REPEAT_STEP_MAX)
+    {
+      loop->_repeatCount = 0;
+      loop->_repeatStep *= 2;
+    }
+    loop->_repeatHandle = loop->_timers.add(loop->_clock.now(), loop->_repeatInterval, 0, 0, _repeat, loop);
+  }
+
+  MinuBasic<Backend> &_menu;
+  Waiter _waiter;
+  Clock _clock;
+  MinuQueue<uint8_t, MINU_LOOP_QUEUE_LEN> _events;
+  std::atomic<bool> _renderRequested;
+  std::atomic<bool> _running;
+  uint16_t _renderCount;
+  MinuInputHandler _inputHandler;
+  void *_inputHandlerArg;
+  MinuCallbackFunction _preRenderCallback;
+  void *_preRenderArg;
+  MinuTimerWheel _timers;
+  ssize_t _lastPage;
+  ssize_t _lastHighlightedIndex;
+  MinuDeferredCallbacks *_deferred;
+  bool _skipWait;
+  bool _attached;           // Whether the waiter was attached to the task running the loop
+  uint32_t _settleMs;
+  ssize_t _settleHandle;
+  ssize_t _pendingHighlightPage;
+  uint32_t _repeatDelayMs;
+  uint32_t _repeatIntervalMs;
+  uint32_t _repeatMinIntervalMs;
+  ssize_t _repeatHandle;
+  ssize_t _repeatPage;
+  ssize_t _repeatDirection;
+  ssize_t _repeatStep;
+  uint32_t _repeatCount;
+  uint32_t _repeatInterval;
+  ssize_t _openPage;
+  uint32_t _releaseDelayMs;
+  ssize_t _releaseHandle;
+  uint32_t _renderBudgetMs;
+  size_t _renderBudgetBytes;
+  uint32_t _sliceDeadline;
+#ifdef MINU_HAS_ACTIONS
+  MinuActionRunner _actions;
+#endif
+#ifdef MINU_LOOP_STACK_PROBE
+  MinuStackProbe _renderProbe;
+  MinuStackProbe _callbackProbe;
+#endif
+};
+
+#endif
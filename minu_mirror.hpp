@@ -0,0 +1,735 @@
+/*
+ * @file  minu_mirror.hpp
+ * @brief Compact binary delta protocol for mirroring a rendered Minu to a remote display or host tool.
+ *
+ * The encoder observes every frame rendered by a Minu, reconstructs it as a grid of character cells and
+ * transmits only the cells that changed since the previous frame. The decoder consumes the resulting byte
+ * stream (from any transport e.g. UART, TCP, a log file) and rebuilds the same grid on the host.
+ *
+ * Packet layout (multi-byte fixed-width fields are little-endian, "varint" is unsigned LEB128):
+ *
+ *   sync    2 bytes   0xA5 0x5A
+ *   length  2 bytes   Number of payload bytes
+ *   payload n bytes
+ *   crc     2 bytes   CRC-16/CCITT-FALSE of the payload
+ *
+ * Payload:
+ *
+ *   type        1 byte   MinuMirrorPacketType
+ *   frame id    2 bytes  Incremented for every packet sent
+ *   base id     2 bytes  (delta only) Id of the frame the delta must be applied on top of
+ *   cols, rows  varint   (keyframe only) Grid dimensions
+ *   palette     2 bytes  (palette keyframe only) MINU_PALETTE_SIZE RGB565 colours
+ *   page        varint   Id of the rendered page + 1 (0 if there was none)
+ *   highlight   varint   Index of the highlighted item + 1 (0 if there was none)
+ *   run count   varint
+ *   runs        Each run is a horizontal span of cells sharing one colour pair:
+ *                 row, col  varint
+ *                 header    varint   (length << 1) | coloursFollow
+ *                 fore,back 2 bytes each, only if coloursFollow is set. Otherwise the previous run's colours
+ *                           (initially the default colours) are reused
+ *                 chars     length bytes
+ *
+ * A keyframe is encoded as a delta against a blank grid, so it replaces the whole screen. Keyframes are sent
+ * periodically and on request so that a decoder that missed a packet resynchronises without a back channel.
+ *
+ * Payloads are at most MINU_MIRROR_PAYLOAD_MAX bytes. A frame whose runs do not fit is sent as several packets, the
+ * first of them a keyframe or delta and the rest deltas on top of the one before, so the decoder shows it in parts.
+ * A decoder takes a longer length as a corrupted header.
+ *
+ * An encoder built with MINU_PALETTE sees palette indices rather than RGB565 colours, and sends palette keyframes,
+ * which carry the palette the indices refer to. The palette is sent again, in a keyframe, whenever it changes. A
+ * decoder built without MINU_PALETTE resolves the indices, so its grid holds RGB565 colours either way. A decoder
+ * built with MINU_PALETTE keeps the indices, and only accepts palette keyframes.
+ */
+
+#ifndef _LIBMINU_MIRROR_H_
+#define _LIBMINU_MIRROR_H_
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include <algorithm>
+
+#include "minu.hpp"
+
+#define MINU_MIRROR_SYNC_0                    0xA5
+#define MINU_MIRROR_SYNC_1                    0x5A
+#define MINU_MIRROR_KEYFRAME_INTERVAL_DEFAULT 32    // Number of frames between unsolicited keyframes
+#define MINU_MIRROR_RUN_GAP                   3     // Maximum number of unchanged cells merged into a run to avoid starting a new one
+#ifndef MINU_MIRROR_PAYLOAD_MAX
+#define MINU_MIRROR_PAYLOAD_MAX               4096  // Longest payload. Larger frames are split into several packets
+#endif
+
+/// @brief Types of packets in a mirror stream
+enum MinuMirrorPacketType
+{
+  MINU_MIRROR_PACKET_KEYFRAME = 1,
+  MINU_MIRROR_PACKET_DELTA = 2,
+  MINU_MIRROR_PACKET_PALETTE_KEYFRAME = 3,  // Keyframe whose colours are indices into the palette it carries
+};
+
+/// @brief      Function used by the encoder to transmit a complete packet
+/// @param data Packet bytes
+/// @param len  Number of bytes in the packet
+/// @param arg  User-defined argument registered along with the function
+typedef void (*MinuMirrorWriteFunction)(const uint8_t *data, size_t len, void *arg);
+
+/// @brief Update a CRC-16/CCITT-FALSE checksum with the given data
+inline uint16_t minuMirrorCrc16(const uint8_t *data, size_t len, uint16_t crc = 0xFFFF)
+{
+  while (len--)
+  {
+    crc ^= (uint16_t)(*data++) << 8;
+    for (uint8_t i = 0; i < 8; ++i)
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+  }
+  return crc;
+}
+
+/// @brief Encodes the frames rendered by a Minu into a stream of mirror packets.
+/// @note  Register the encoder with Minu::setRenderObserver(). A packet is produced at the end of each render()
+///        in which something visible changed.
+class MinuMirrorEncoder : public MinuRenderObserver
+{
+
+public:
+  /// @brief Class constructor
+  /// @param cols     Number of characters per row on the mirrored display
+  /// @param rows     Number of rows on the mirrored display
+  /// @param write    Function used to transmit packets
+  /// @param arg      User-defined argument passed to \a write
+  /// @param keyframeInterval Number of frames between unsolicited keyframes. 0 disables periodic keyframes
+  MinuMirrorEncoder(uint16_t cols, uint16_t rows, MinuMirrorWriteFunction write, void *arg = NULL,
+                    uint16_t keyframeInterval = MINU_MIRROR_KEYFRAME_INTERVAL_DEFAULT)
+      : _current(cols, rows), _sent(cols, rows), _blank(cols, rows)
+  {
+    this->_write = write;
+    this->_writeArg = arg;
+    this->_keyframeInterval = keyframeInterval;
+    this->_framesSinceKeyframe = 0;
+    this->_keyframePending = true;
+    this->_frameId = 0;
+    this->_pageId = -1;
+    this->_highlightedIndex = -1;
+    this->_sentPageId = -1;
+    this->_sentHighlightedIndex = -1;
+    this->_framesSplit = 0;
+#ifdef MINU_PALETTE
+    this->_palette = NULL;
+#endif
+  }
+
+#ifdef MINU_PALETTE
+  /// @brief Set the palette that the colours of the observed menu are indices into, e.g. &menu.palette()
+  /// @note  Keyframes carry the default palette until one is set. A change to the palette forces a keyframe
+  void setPalette(const MinuPalette *palette) { this->_palette = palette; }
+#endif
+
+  /// @brief Force the next packet to be a keyframe, e.g. when a host reports that it lost synchronisation
+  void requestKeyframe(void) { this->_keyframePending = true; }
+
+  /// @brief Immediately transmit a keyframe of the last rendered frame
+  void sendKeyframe(void) { this->_send(true); }
+
+  /// @brief Returns the id of the last packet sent
+  uint16_t frameId() const { return this->_frameId; }
+
+  /// @brief Returns the size in bytes of the last packet sent
+  size_t lastPacketSize() const { return this->_packet.size(); }
+
+  /// @brief Returns the number of frames too large for one packet, which were sent in several
+  uint32_t framesSplit() const { return this->_framesSplit; }
+
+  /// @brief Returns the RAM used by the copies of the frame and the packet buffers
+  MinuMemoryUsage memoryUsage() const
+  {
+    MinuMemoryUsage usage;
+    usage.caches = this->_current.memoryUsage() + this->_sent.memoryUsage() + this->_blank.memoryUsage();
+    usage.scratch = this->_payload.capacity() + this->_packet.capacity();
+    return usage;
+  }
+
+  void frameStarted(ssize_t pageId, ssize_t highlightedIndex, bool partial)
+  {
+    this->_pageId = pageId;
+    this->_highlightedIndex = highlightedIndex;
+    if (!partial)
+      this->_current.clear();
+    this->_writer.home();
+  }
+
+  void cursorMoved(uint16_t col, uint16_t row) { this->_writer.moveTo(col, row); }
+
+  void fragmentPrinted(const char *msg, uint16_t len, uint16_t fore, uint16_t back, bool inverted)
+  {
+    this->_writer.write(this->_current, msg, len, fore, back, inverted);
+  }
+
+  void frameFinished(void)
+  {
+    bool keyframe = this->_keyframePending ||
+                    (this->_keyframeInterval && this->_framesSinceKeyframe >= this->_keyframeInterval);
+#ifdef MINU_PALETTE
+    keyframe |= this->_currentPalette() != this->_sentPalette;
+#endif
+    this->_send(keyframe);
+  }
+
+private:
+  static const size_t RUN_HEADER_MAX = 13;  // Longest run header: row, col and header varints, and both colours
+
+  /// @brief Encode and transmit the current frame
+  /// @param keyframe Whether to encode the frame against a blank grid rather than the last frame sent
+  /// @note  Runs that do not fit in one packet are sent in further deltas, each on top of the packet before
+  void _send(bool keyframe)
+  {
+    if (!this->_write)
+      return;
+
+    const MinuCellGrid *base = (keyframe) ? &this->_blank : &this->_sent;
+    uint16_t row = 0, col = 0;
+    for (bool first = true;; first = false)
+    {
+      this->_payload.clear();
+#ifdef MINU_PALETTE
+      this->_payload.push_back((keyframe && first) ? MINU_MIRROR_PACKET_PALETTE_KEYFRAME : MINU_MIRROR_PACKET_DELTA);
+#else
+      this->_payload.push_back((keyframe && first) ? MINU_MIRROR_PACKET_KEYFRAME : MINU_MIRROR_PACKET_DELTA);
+#endif
+      uint16_t baseId = this->_frameId;
+      this->_putU16(this->_frameId + 1);
+      if (keyframe && first)
+      {
+        this->_putVarint(this->_current.cols());
+        this->_putVarint(this->_current.rows());
+#ifdef MINU_PALETTE
+        for (uint8_t i = 0; i < MINU_PALETTE_SIZE; ++i)
+          this->_putU16(this->_currentPalette().colour(i));
+        this->_sentPalette = this->_currentPalette();
+#endif
+      }
+      else
+        this->_putU16(baseId);
+      this->_putVarint(this->_pageId + 1);
+      this->_putVarint(this->_highlightedIndex + 1);
+
+      // Reserve the worst-case space for the run count, since it is only known once every run is encoded
+      size_t countPos = this->_payload.size();
+      this->_payload.insert(this->_payload.end(), 3, 0);
+      size_t runs = this->_encodeRuns(*base, row, col);
+
+      // An unchanged frame is not worth a packet
+      if (first && !keyframe && !runs && this->_pageId == this->_sentPageId &&
+          this->_highlightedIndex == this->_sentHighlightedIndex)
+        return;
+
+      // Patch in the run count as a fixed 3-byte varint so that the payload need not be shifted
+      this->_payload[countPos] = (runs & 0x7F) | 0x80;
+      this->_payload[countPos + 1] = ((runs >> 7) & 0x7F) | 0x80;
+      this->_payload[countPos + 2] = (runs >> 14) & 0x7F;
+      this->_transmit();
+      this->_frameId++;
+      if (row >= this->_current.rows())
+        break;
+
+      // The next packet continues from what the decoder now shows
+      if (first)
+        this->_framesSplit++;
+      if (base != &this->_sent)
+      {
+        this->_sent.copyFrom(*base);
+        base = &this->_sent;
+      }
+      this->_copySent(row, col);
+    }
+
+    this->_sent.copyFrom(this->_current);
+    this->_sentPageId = this->_pageId;
+    this->_sentHighlightedIndex = this->_highlightedIndex;
+    if (keyframe)
+    {
+      this->_keyframePending = false;
+      this->_framesSinceKeyframe = 0;
+    }
+    else
+      this->_framesSinceKeyframe++;
+  }
+
+  /// @brief Frame the payload as a packet and pass it to the write function
+  void _transmit(void)
+  {
+    uint16_t crc = minuMirrorCrc16(this->_payload.data(), this->_payload.size());
+    this->_packet.clear();
+    this->_packet.push_back(MINU_MIRROR_SYNC_0);
+    this->_packet.push_back(MINU_MIRROR_SYNC_1);
+    this->_packet.push_back(this->_payload.size() & 0xFF);
+    this->_packet.push_back(this->_payload.size() >> 8);
+    this->_packet.insert(this->_packet.end(), this->_payload.begin(), this->_payload.end());
+    this->_packet.push_back(crc & 0xFF);
+    this->_packet.push_back(crc >> 8);
+    this->_write(this->_packet.data(), this->_packet.size(), this->_writeArg);
+  }
+
+  /// @brief Copy the cells of the current frame that come before \a row, \a col into the copy of the frame sent
+  void _copySent(uint16_t row, uint16_t col)
+  {
+    for (uint16_t r = 0; r <= row && r < this->_current.rows(); ++r)
+    {
+      const MinuCell *cur = this->_current.row(r);
+      std::copy(cur, cur + ((r < row) ? this->_current.cols() : col), this->_sent.row(r));
+    }
+  }
+
+  /// @brief  Append the runs of cells that differ between the current frame and \a base, until the payload is full
+  /// @param  row First row to encode. Set to the row to continue at, or to rows() once every run is appended
+  /// @param  col First column to encode in \a row. Set to the column to continue at
+  /// @return Number of runs appended
+  size_t _encodeRuns(const MinuCellGrid &base, uint16_t &row, uint16_t &col)
+  {
+    size_t runs = 0;
+    uint16_t fore = MINU_FOREGROUND_COLOUR_DEFAULT;
+    uint16_t back = MINU_BACKGROUND_COLOUR_DEFAULT;
+    const uint16_t cols = this->_current.cols();
+
+    for (; row < this->_current.rows(); ++row, col = 0)
+    {
+      const MinuCell *cur = this->_current.row(row);
+      const MinuCell *old = base.row(row);
+      while (col < cols)
+      {
+        if (cur[col] == old[col])
+        {
+          col++;
+          continue;
+        }
+
+        // Once not even one more character fits, the rest of the frame goes in the next packet
+        size_t room = MINU_MIRROR_PAYLOAD_MAX - this->_payload.size();
+        if (room <= RUN_HEADER_MAX)
+          return runs;
+
+        // Extend the run over cells with the same colours.
+        // Short stretches of unchanged cells are included if they are followed by another change,
+        // since that is cheaper than the header of a new run
+        uint16_t start = col;
+        uint16_t end = col + 1;
+        for (uint16_t scan = col + 1; scan < cols; ++scan)
+        {
+          if (cur[scan].fore != cur[start].fore || cur[scan].back != cur[start].back)
+            break;
+          if (cur[scan] != old[scan])
+            end = scan + 1;
+          else if (scan - end >= MINU_MIRROR_RUN_GAP)
+            break;
+        }
+        if ((size_t)(end - start) > room - RUN_HEADER_MAX)
+          end = start + (room - RUN_HEADER_MAX);
+
+        bool coloursFollow = (cur[start].fore != fore || cur[start].back != back);
+        this->_putVarint(row);
+        this->_putVarint(start);
+        this->_putVarint(((uint32_t)(end - start) << 1) | coloursFollow);
+        if (coloursFollow)
+        {
+          fore = cur[start].fore;
+          back = cur[start].back;
+          this->_putU16(fore);
+          this->_putU16(back);
+        }
+        for (uint16_t i = start; i < end; ++i)
+          this->_payload.push_back((uint8_t)cur[i].ch);
+
+        runs++;
+        col = end;
+      }
+    }
+    return runs;
+  }
+
+#ifdef MINU_PALETTE
+  const MinuPalette &_currentPalette(void) const
+  {
+    static const MinuPalette defaults;
+    return (this->_palette) ? *this->_palette : defaults;
+  }
+#endif
+
+  void _putU16(uint16_t v)
+  {
+    this->_payload.push_back(v & 0xFF);
+    this->_payload.push_back(v >> 8);
+  }
+
+  void _putVarint(uint32_t v)
+  {
+    while (v >= 0x80)
+    {
+      this->_payload.push_back((v & 0x7F) | 0x80);
+      v >>= 7;
+    }
+    this->_payload.push_back(v);
+  }
+
+  MinuCellGrid _current;
+  MinuCellGrid _sent;
+  MinuCellGrid _blank;
+  MinuGridWriter _writer;
+  std::vector<uint8_t> _payload;
+  std::vector<uint8_t> _packet;
+  MinuMirrorWriteFunction _write;
+  void *_writeArg;
+  uint16_t _keyframeInterval;
+  uint16_t _framesSinceKeyframe;
+  bool _keyframePending;
+  uint16_t _frameId;
+  ssize_t _pageId;
+  ssize_t _highlightedIndex;
+  ssize_t _sentPageId;
+  ssize_t _sentHighlightedIndex;
+  uint32_t _framesSplit;
+#ifdef MINU_PALETTE
+  const MinuPalette *_palette;
+  MinuPalette _sentPalette;  // Palette carried by the last keyframe
+#endif
+};
+
+/// @brief Reconstructs the mirrored display from a stream of packets produced by a MinuMirrorEncoder.
+/// @note  Bytes can be fed in arbitrarily sized chunks. Corrupted packets are skipped, and deltas that do not
+///        follow the last applied frame are discarded until the next keyframe arrives.
+class MinuMirrorDecoder
+{
+
+public:
+  MinuMirrorDecoder()
+  {
+    this->_state = STATE_SYNC_0;
+    this->_valid = false;
+    this->_frameId = 0;
+    this->_pageId = -1;
+    this->_highlightedIndex = -1;
+    this->_framesApplied = 0;
+    this->_framesDropped = 0;
+    this->_packetErrors = 0;
+    this->_frameCallback = NULL;
+    this->_paletted = false;
+  }
+
+  /// @brief Set a function to be called whenever a frame has been applied to the grid
+  /// @note  When called, the pointer to this decoder is passed as the parameter.
+  void setFrameCallback(MinuCallbackFunction cb) { this->_frameCallback = cb; }
+
+  /// @brief Consume bytes received from the transport
+  void feed(const uint8_t *data, size_t len)
+  {
+    for (size_t i = 0; i < len; ++i)
+    {
+      if (this->_feedByte(data[i]))
+        continue;
+
+      // A corrupted header may have swallowed the start of a real packet, so the bytes after its first sync byte are
+      // scanned again. Each rescan drops at least that byte, so it ends
+      this->_rescan.assign(this->_raw.begin() + 1, this->_raw.end());
+      this->_raw.clear();
+      for (size_t j = 0; j < this->_rescan.size(); ++j)
+      {
+        if (this->_feedByte(this->_rescan[j]))
+          continue;
+        std::vector<uint8_t> rest(this->_raw.begin() + 1, this->_raw.end());
+        rest.insert(rest.end(), this->_rescan.begin() + j + 1, this->_rescan.end());
+        this->_rescan.swap(rest);
+        this->_raw.clear();
+        j = (size_t)-1;
+      }
+    }
+  }
+
+  /// @brief Returns the reconstructed display contents
+  const MinuCellGrid &grid() const { return this->_grid; }
+
+  /// @brief Whether a keyframe has been received and every delta since has been applied
+  bool valid() const { return this->_valid; }
+
+  /// @brief Whether the decoder is waiting for a keyframe to resynchronise
+  /// @note  If the transport has a back channel, this can be relayed to MinuMirrorEncoder::requestKeyframe()
+  bool needsKeyframe() const { return !this->_valid; }
+
+  /// @brief Returns the id of the last frame applied
+  uint16_t frameId() const { return this->_frameId; }
+
+  /// @brief Returns the id of the page shown in the last frame, or -1
+  ssize_t pageId() const { return this->_pageId; }
+
+  /// @brief Returns the index of the item highlighted in the last frame, or -1
+  ssize_t highlightedIndex() const { return this->_highlightedIndex; }
+
+  /// @brief Whether the stream's colours are indices into palette(), i.e. it was encoded with MINU_PALETTE
+  bool paletted() const { return this->_paletted; }
+
+  /// @brief Returns the palette carried by the last palette keyframe
+  const MinuPalette &palette() const { return this->_palette; }
+
+  /// @brief Returns the number of frames applied to the grid
+  uint32_t framesApplied() const { return this->_framesApplied; }
+
+  /// @brief Returns the number of valid deltas discarded because an earlier frame was missed
+  uint32_t framesDropped() const { return this->_framesDropped; }
+
+  /// @brief Returns the number of packets discarded due to checksum or format errors
+  uint32_t packetErrors() const { return this->_packetErrors; }
+
+private:
+  enum State
+  {
+    STATE_SYNC_0,
+    STATE_SYNC_1,
+    STATE_LEN_0,
+    STATE_LEN_1,
+    STATE_PAYLOAD,
+    STATE_CRC_0,
+    STATE_CRC_1,
+  };
+
+  static const size_t HEADER_LEN = 4;  // Sync and length bytes before the payload
+
+  /// @brief  Consume one byte, keeping the bytes of the packet in progress from its first sync byte on
+  /// @return false, if the packet's length or checksum was wrong, so its bytes should be scanned again for a sync
+  bool _feedByte(uint8_t b)
+  {
+    if (this->_state == STATE_SYNC_0 || (this->_state == STATE_SYNC_1 && b == MINU_MIRROR_SYNC_0))
+      this->_raw.clear();
+    this->_raw.push_back(b);
+
+    switch (this->_state)
+    {
+    case STATE_SYNC_0:
+      if (b == MINU_MIRROR_SYNC_0)
+        this->_state = STATE_SYNC_1;
+      break;
+
+    case STATE_SYNC_1:
+      if (b == MINU_MIRROR_SYNC_1)
+        this->_state = STATE_LEN_0;
+      else if (b != MINU_MIRROR_SYNC_0)
+        this->_state = STATE_SYNC_0;
+      break;
+
+    case STATE_LEN_0:
+      this->_length = b;
+      this->_state = STATE_LEN_1;
+      break;
+
+    case STATE_LEN_1:
+      this->_length |= (uint16_t)b << 8;
+      // The encoder never sends more, so a longer length is a corrupted header rather than a packet to wait for
+      if (this->_length > MINU_MIRROR_PAYLOAD_MAX)
+      {
+        this->_state = STATE_SYNC_0;
+        this->_packetErrors++;
+        return false;
+      }
+      this->_state = (this->_length) ? STATE_PAYLOAD : STATE_CRC_0;
+      break;
+
+    case STATE_PAYLOAD:
+      if (this->_raw.size() == HEADER_LEN + this->_length)
+        this->_state = STATE_CRC_0;
+      break;
+
+    case STATE_CRC_0:
+      this->_crc = b;
+      this->_state = STATE_CRC_1;
+      break;
+
+    case STATE_CRC_1:
+      this->_crc |= (uint16_t)b << 8;
+      this->_state = STATE_SYNC_0;
+      if (this->_crc != minuMirrorCrc16(this->_raw.data() + HEADER_LEN, this->_length))
+      {
+        this->_packetErrors++;
+        return false;
+      }
+      if (!this->_apply())
+        this->_packetErrors++;
+      break;
+    }
+    return true;
+  }
+
+  /// @brief  Apply the received payload to the grid
+  /// @return false, if the payload was malformed
+  bool _apply(void)
+  {
+    this->_pos = HEADER_LEN;
+    this->_end = HEADER_LEN + this->_length;
+    uint8_t type;
+    uint16_t frameId, baseId = 0;
+    uint32_t cols = 0, rows = 0, page, highlight, runs;
+    MinuPalette palette;
+
+    if (!this->_getU8(type) || !this->_getU16(frameId))
+      return false;
+
+    bool keyframe = (type == MINU_MIRROR_PACKET_KEYFRAME || type == MINU_MIRROR_PACKET_PALETTE_KEYFRAME);
+    if (keyframe)
+    {
+      if (!this->_getVarint(cols) || !this->_getVarint(rows) || cols > 0xFFFF || rows > 0xFFFF)
+        return false;
+#ifdef MINU_PALETTE
+      // Indices cannot be made up for RGB565 colours
+      if (type != MINU_MIRROR_PACKET_PALETTE_KEYFRAME)
+        return this->_invalidate();
+#endif
+      for (uint8_t i = 0; type == MINU_MIRROR_PACKET_PALETTE_KEYFRAME && i < MINU_PALETTE_SIZE; ++i)
+      {
+        uint16_t colour;
+        if (!this->_getU16(colour))
+          return false;
+        palette.set(i, colour);
+      }
+    }
+    else if (type == MINU_MIRROR_PACKET_DELTA)
+    {
+      if (!this->_getU16(baseId))
+        return false;
+    }
+    else
+      return false;
+
+    if (!this->_getVarint(page) || !this->_getVarint(highlight) || !this->_getVarint(runs))
+      return false;
+
+    if (keyframe)
+    {
+      this->_paletted = (type == MINU_MIRROR_PACKET_PALETTE_KEYFRAME);
+      this->_palette = palette;
+    }
+
+    // Runs start out with the default colours of the encoder's build
+    uint16_t fore = (this->_paletted) ? (uint16_t)MINU_PALETTE_WHITE : (uint16_t)MINU_FOREGROUND_COLOUR_DEFAULT;
+    uint16_t back = (this->_paletted) ? (uint16_t)MINU_PALETTE_BLACK : (uint16_t)MINU_BACKGROUND_COLOUR_DEFAULT;
+    if (keyframe)
+    {
+      if (cols != this->_grid.cols() || rows != this->_grid.rows())
+        this->_grid.resize(cols, rows);
+      this->_grid.clear(this->_colour(fore), this->_colour(back));
+    }
+    else if (!this->_valid || baseId != this->_frameId)
+    {
+      // A frame was missed. The grid cannot be brought up to date until the next keyframe
+      this->_valid = false;
+      this->_framesDropped++;
+      return true;
+    }
+
+    while (runs--)
+    {
+      uint32_t row, col, header;
+      if (!this->_getVarint(row) || !this->_getVarint(col) || !this->_getVarint(header))
+        return this->_invalidate();
+
+      if (header & 1)
+      {
+        if (!this->_getU16(fore) || !this->_getU16(back))
+          return this->_invalidate();
+      }
+
+      uint32_t len = header >> 1;
+      if (this->_pos + len > this->_end)
+        return this->_invalidate();
+
+      for (uint32_t i = 0; i < len; ++i, ++col)
+      {
+        if (row < this->_grid.rows() && col < this->_grid.cols())
+        {
+          MinuCell &cell = this->_grid.at(col, row);
+          cell.ch = (char)this->_raw[this->_pos + i];
+          cell.fore = this->_colour(fore);
+          cell.back = this->_colour(back);
+        }
+      }
+      this->_pos += len;
+    }
+
+    this->_valid = true;
+    this->_frameId = frameId;
+    this->_pageId = (ssize_t)page - 1;
+    this->_highlightedIndex = (ssize_t)highlight - 1;
+    this->_framesApplied++;
+
+    if (this->_frameCallback)
+      this->_frameCallback(this);
+    return true;
+  }
+
+  /// @brief Returns the colour a cell of the grid holds for a colour of the stream
+  uint16_t _colour(uint16_t colour) const
+  {
+#ifdef MINU_PALETTE
+    return colour;
+#else
+    return (this->_paletted) ? this->_palette.colour(colour) : colour;
+#endif
+  }
+
+  /// @brief Mark the grid as out of sync after a partially applied payload
+  bool _invalidate(void)
+  {
+    this->_valid = false;
+    return false;
+  }
+
+  bool _getU8(uint8_t &v)
+  {
+    if (this->_pos + 1 > this->_end)
+      return false;
+    v = this->_raw[this->_pos++];
+    return true;
+  }
+
+  bool _getU16(uint16_t &v)
+  {
+    if (this->_pos + 2 > this->_end)
+      return false;
+    v = this->_raw[this->_pos] | ((uint16_t)this->_raw[this->_pos + 1] << 8);
+    this->_pos += 2;
+    return true;
+  }
+
+  bool _getVarint(uint32_t &v)
+  {
+    v = 0;
+    for (uint8_t shift = 0; shift < 35; shift += 7)
+    {
+      uint8_t b;
+      if (!this->_getU8(b))
+        return false;
+      v |= (uint32_t)(b & 0x7F) << shift;
+      if (!(b & 0x80))
+        return true;
+    }
+    return false;
+  }
+
+  State _state;
+  uint16_t _length;
+  uint16_t _crc;
+  std::vector<uint8_t> _raw;     // Bytes of the packet in progress, from its first sync byte on
+  std::vector<uint8_t> _rescan;  // Bytes of a rejected packet being scanned again
+  size_t _pos;                   // Position of the next payload byte to read in _raw
+  size_t _end;                   // Position after the last payload byte in _raw
+
+  MinuCellGrid _grid;
+  bool _valid;
+  uint16_t _frameId;
+  ssize_t _pageId;
+  ssize_t _highlightedIndex;
+  uint32_t _framesApplied;
+  uint32_t _framesDropped;
+  uint32_t _packetErrors;
+  MinuCallbackFunction _frameCallback;
+  bool _paletted;
+  MinuPalette _palette;
+};
+
+#endif
@@ -0,0 +1,312 @@
+/*
+ * @file  minu_pipeline.hpp
+ * @brief Splits rendering into two stages that run on different tasks or cores: laying frames out and printing them.
+ *
+ * A MinuPipelineRecorder is the print backend of the menu. It lays nothing out itself, but records the fragments
+ * that render() gives it into a frame, a list of commands with the text they print. Finished frames are handed to the
+ * output task, which plays them to the real backend, e.g. a MinuFunctionBackend or a MinuPixelRenderer driving the
+ * SPI display. The task walking the menu thus never waits for the display, and on a dual-core ESP32 both run at once.
+ *
+ * Frames are exchanged through three preallocated buffers, one being recorded, one ready and one being printed,
+ * swapped with a single atomic exchange, so neither side ever blocks on the other or allocates once the buffers have
+ * grown to the size of a frame. When the output falls behind, a new frame replaces the ready one, which is dropped:
+ * the display skips straight to the latest state. A partial frame (MinuBasic::renderCanvas()) only updates the frame
+ * before it, so it cannot replace one; while a frame is waiting, the recorder refuses partial frames and the menu
+ * renders the whole page instead.
+ *
+ * On the ESP32, the output task is typically pinned to the other core:
+ *
+ *   MinuPipeline<> pipeline;
+ *   MinuBasic<MinuPipelineRecorder<> > menu(MinuPipelineRecorder<>(&pipeline), MAIN_LEN, AUX_LEN);
+ *   void outputTask(void *arg) { pipeline.run(lcdBackend); }
+ *   xTaskCreatePinnedToCore(outputTask, "Output", 4096, NULL, 1, NULL, 0);
+ *
+ * and on a host, pipeline.run() is given a std::thread. Since the output task prints every frame from scratch,
+ * clearing the display belongs in its backend's begin(false), not in a pre-render callback on the menu's task.
+ */
+
+#ifndef _LIBMINU_PIPELINE_H_
+#define _LIBMINU_PIPELINE_H_
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <vector>
+
+#include "minu.hpp"
+#include "minu_loop.hpp"
+
+#define MINU_PIPELINE_FRAME_COMMANDS  64    // Commands each frame buffer has room for before it first grows
+#define MINU_PIPELINE_FRAME_TEXT      512   // Characters each frame buffer has room for before it first grows
+
+/// @brief Counters describing the work done by a MinuPipeline
+struct MinuPipelineStats
+{
+  uint32_t recorded;  // Frames recorded and handed to the output task
+  uint32_t printed;   // Frames played to the output backend
+  uint32_t dropped;   // Frames replaced by a newer one before the output task took them
+  uint32_t refused;   // Partial frames refused because a frame was waiting, each replaced by a full frame
+};
+
+/// @brief A frame recorded by a MinuPipelineRecorder, as a list of backend calls
+class MinuFrame
+{
+
+public:
+  MinuFrame() : _partial(false), _sequence(0)
+  {
+    this->_commands.reserve(MINU_PIPELINE_FRAME_COMMANDS);
+    this->_text.reserve(MINU_PIPELINE_FRAME_TEXT);
+  }
+
+  /// @brief Empty the frame, keeping its buffers
+  void clear(bool partial, uint32_t sequence)
+  {
+    this->_commands.clear();
+    this->_text.clear();
+    this->_partial = partial;
+    this->_sequence = sequence;
+  }
+
+  /// @brief Record a print() or printInverted() call
+  /// @note  Only the characters up to the first NUL are kept, the backend padding the rest to \a len as before
+  void print(const char *msg, uint16_t len, uint16_t fore, uint16_t back, bool inverted)
+  {
+    Command command = {(uint8_t)((inverted) ? PRINT_INVERTED : PRINT), len, fore, back, (uint32_t)this->_text.size()};
+    size_t n = (msg) ? strnlen(msg, len) : 0;
+    this->_text.insert(this->_text.end(), msg, msg + n);
+    this->_text.push_back(0);
+    this->_commands.push_back(command);
+  }
+
+  /// @brief Record a moveTo() call
+  void moveTo(uint16_t col, uint16_t row)
+  {
+    Command command = {MOVE_TO, 0, col, row, 0};
+    this->_commands.push_back(command);
+  }
+
+  /// @brief Make the calls recorded, between a call to begin() and one to flush()
+  template <class Backend>
+  void playTo(Backend &backend) const
+  {
+    backend.begin(this->_partial);
+    for (size_t i = 0; i < this->_commands.size(); ++i)
+    {
+      const Command &command = this->_commands[i];
+      if (command.type == MOVE_TO)
+        backend.moveTo(command.fore, command.back);
+      else if (command.type == PRINT)
+        backend.print(&this->_text[command.offset], command.len, command.fore, command.back);
+      else
+        backend.printInverted(&this->_text[command.offset], command.len, command.fore, command.back);
+    }
+    backend.flush();
+  }
+
+  /// @brief Whether the frame updates the frame before it rather than replacing it
+  bool partial() const { return this->_partial; }
+
+  /// @brief Returns the number of frames recorded before this one
+  uint32_t sequence() const { return this->_sequence; }
+
+  /// @brief Returns the heap bytes held by the frame's buffers
+  size_t memoryUsage() const { return this->_commands.capacity() * sizeof(Command) + this->_text.capacity(); }
+
+private:
+  enum CommandType
+  {
+    PRINT,
+    PRINT_INVERTED,
+    MOVE_TO,
+  };
+
+  struct Command
+  {
+    uint8_t type;
+    uint16_t len;
+    uint16_t fore;    // Column, for MOVE_TO
+    uint16_t back;    // Row, for MOVE_TO
+    uint32_t offset;  // Offset of the text in _text
+  };
+
+  bool _partial;
+  uint32_t _sequence;
+  std::vector<Command> _commands;
+  std::vector<char> _text;
+};
+
+/// @brief Hands frames recorded on one task to another that prints them. See the top of this file
+/// @note  The recording side (the menu's task) and the output side (run() or print()) must each be a single task
+template <class Waiter = MinuDefaultWaiter>
+class MinuPipeline
+{
+
+public:
+  MinuPipeline()
+  {
+    this->_recording = 0;
+    this->_ready.store(1);
+    this->_printing = 2;
+    this->_printed = 0;
+    this->_running.store(false);
+    this->_recorded.store(0);
+    this->_printedCount.store(0);
+    this->_dropped.store(0);
+    this->_refused.store(0);
+  }
+
+  /// @brief  Print the latest frame, if one is ready
+  /// @note   Only call from the output task
+  /// @return true, if a frame was printed
+  template <class Backend>
+  bool print(Backend &backend)
+  {
+    if (!(this->_ready.load(std::memory_order_acquire) & FRESH))
+      return false;
+
+    // Only the output task clears the flag, so the exchange is sure to return a fresh frame
+    this->_printing = this->_ready.exchange(this->_printing, std::memory_order_acq_rel) & ~FRESH;
+    const MinuFrame &frame = this->_frames[this->_printing];
+    this->_printed = frame.sequence();
+    frame.playTo(backend);
+    this->_printedCount.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /// @brief Print frames as they become ready until stop() is called
+  /// @note  Call from the output task, which sleeps on the waiter while there is nothing to print
+  template <class Backend>
+  void run(Backend &backend)
+  {
+    this->_waiter.attach();
+    this->_running.store(true);
+    while (this->_running.load())
+    {
+      if (!this->print(backend))
+        this->_waiter.wait(MINU_WAIT_FOREVER);
+    }
+  }
+
+  /// @brief Make run() return once it has printed the frame it is printing, if any
+  void stop(void)
+  {
+    this->_running.store(false);
+    this->_waiter.notify();
+  }
+
+  /// @brief Whether a frame is ready and has not been taken by the output task yet
+  bool pending() const { return this->_ready.load(std::memory_order_acquire) & FRESH; }
+
+  /// @brief Returns the sequence number of the frame being printed, or last printed. See MinuFrame::sequence()
+  /// @note  Only call from the output task, e.g. from its backend's flush()
+  uint32_t printedSequence() const { return this->_printed; }
+
+  MinuPipelineStats stats() const
+  {
+    MinuPipelineStats stats = {this->_recorded.load(), this->_printedCount.load(), this->_dropped.load(),
+                               this->_refused.load()};
+    return stats;
+  }
+
+  /// @brief Returns the RAM used by the frame buffers
+  MinuMemoryUsage memoryUsage() const
+  {
+    MinuMemoryUsage usage;
+    usage.scratch = sizeof(MinuPipeline);
+    for (size_t i = 0; i < 3; ++i)
+      usage.caches += this->_frames[i].memoryUsage();
+    return usage;
+  }
+
+  /// @brief Returns the frame being recorded. Used by MinuPipelineRecorder
+  MinuFrame &recording() { return this->_frames[this->_recording]; }
+
+  /// @brief  Start recording a frame. Used by MinuPipelineRecorder
+  /// @return false, if the frame is partial and cannot be recorded because the output task is behind
+  bool beginFrame(bool partial)
+  {
+    if (partial && this->pending())
+    {
+      this->_refused.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    this->recording().clear(partial, this->_recorded.load(std::memory_order_relaxed));
+    return true;
+  }
+
+  /// @brief Hand the recorded frame to the output task, dropping the ready frame if it was not taken yet
+  void publish(void)
+  {
+    uint8_t previous = this->_ready.exchange(this->_recording | FRESH, std::memory_order_acq_rel);
+    if (previous & FRESH)
+      this->_dropped.fetch_add(1, std::memory_order_relaxed);
+    this->_recording = previous & ~FRESH;
+    this->_recorded.fetch_add(1, std::memory_order_relaxed);
+    this->_waiter.notify();
+  }
+
+private:
+  static const uint8_t FRESH = 0x80;  // Flag set in _ready while the frame in it has not been taken
+
+  MinuFrame _frames[3];
+  uint8_t _recording;           // Buffer being recorded, only used by the recording task
+  std::atomic<uint8_t> _ready;  // Buffer ready to be printed, with FRESH set until the output task takes it
+  uint8_t _printing;            // Buffer being printed, only used by the output task
+  uint32_t _printed;
+  std::atomic<bool> _running;
+  std::atomic<uint32_t> _recorded;
+  std::atomic<uint32_t> _printedCount;
+  std::atomic<uint32_t> _dropped;
+  std::atomic<uint32_t> _refused;
+  Waiter _waiter;
+};
+
+/// @brief Print backend recording frames into a MinuPipeline, for use with MinuBasic
+/// @note  Held by value by the menu, so it only points to the pipeline, which must outlive it
+template <class Waiter = MinuDefaultWaiter>
+class MinuPipelineRecorder
+{
+
+public:
+  MinuPipelineRecorder(MinuPipeline<Waiter> *pipeline = NULL) : _pipeline(pipeline), _recording(false) {}
+
+  void begin(bool partial) { this->_recording = this->_pipeline && this->_pipeline->beginFrame(partial); }
+
+  /// @return false, if the frame was refused, so that the menu renders the whole page instead
+  bool moveTo(uint16_t col, uint16_t row)
+  {
+    if (!this->_recording)
+      return false;
+    this->_pipeline->recording().moveTo(col, row);
+    return true;
+  }
+
+  void print(const char *msg, uint16_t len, uint16_t fore, uint16_t back)
+  {
+    if (this->_recording)
+      this->_pipeline->recording().print(msg, len, fore, back, false);
+  }
+
+  void printInverted(const char *msg, uint16_t len, uint16_t fore, uint16_t back)
+  {
+    if (this->_recording)
+      this->_pipeline->recording().print(msg, len, fore, back, true);
+  }
+
+  void flush(void)
+  {
+    if (this->_recording)
+      this->_pipeline->publish();
+    this->_recording = false;
+  }
+
+  /// @brief Returns the pipeline recorded into
+  MinuPipeline<Waiter> *pipeline() const { return this->_pipeline; }
+
+private:
+  MinuPipeline<Waiter> *_pipeline;
+  bool _recording;
+};
+
+#endif
@@ -0,0 +1,523 @@
+/*
+ * @file  minu_probe.hpp
+ * @brief Probes a list of hosts concurrently and reports each result as it arrives, e.g. for a page of ping targets.
+ *
+ * A MinuProbeEngine keeps one echo in flight per target at most, and every target runs on its own schedule: an echo
+ * is sent every intervalMs, and is lost if no reply arrives within timeoutMs. A lost echo is retried at once, and
+ * once MINU_PROBE_ATTEMPTS echoes in a row are lost, the target is reported unreachable. Unreachable targets are then
+ * probed with a single echo at intervals that double each time, up to MINU_PROBE_BACKOFF_MAX_MS, until one replies.
+ * A callback is given each target's result as soon as its echo completes, so a page of targets fills in the time of
+ * the slowest reply rather than the sum of all of them.
+ *
+ * How echoes are sent and received is defined by a transport class, which provides:
+ *
+ *   bool send(size_t target, const char *host, uint16_t sequence)
+ *     Send an echo request to the host of a target. Returns false if it could not be sent, e.g. the host did not
+ *     resolve, in which case the target is reported unreachable at once.
+ *   bool receive(size_t &target, uint16_t &sequence, uint32_t timeoutMs)
+ *     Wait up to timeoutMs for an echo reply, and return the target and sequence of the request it answers. Returns
+ *     false on timeout.
+ *   void forget(size_t target)
+ *     Drop anything kept about a target, e.g. its resolved address, because its index is about to be reused for
+ *     another host.
+ *
+ * MinuSocketTransport sends ICMP echo requests (ping) through the BSD socket API of lwIP on the ESP32 or of Linux,
+ * or UDP datagrams to echo servers, e.g. a fake responder on the loopback interface (see extras/probe).
+ */
+
+#ifndef _LIBMINU_PROBE_H_
+#define _LIBMINU_PROBE_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+
+#include "minu.hpp"
+#include "minu_loop.hpp"
+
+#if defined(ESP_PLATFORM)
+#include "lwip/sockets.h"
+#include "lwip/netdb.h"
+#elif defined(__linux__)
+#include <netdb.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#endif
+
+#define MINU_PROBE_TARGET_MAX         32     // Maximum number of targets
+#define MINU_PROBE_HOST_LEN           64     // Longest host name, including the NUL
+#define MINU_PROBE_INTERVAL_MS        1000   // Default interval between echoes to a reachable target
+#define MINU_PROBE_TIMEOUT_MS         1000   // Default time after which an echo is lost
+#define MINU_PROBE_ATTEMPTS           3      // Echoes lost in a row before a target is reported unreachable
+#define MINU_PROBE_BACKOFF_MAX_MS     30000  // Longest interval between echoes to an unreachable target
+#define MINU_PROBE_POLL_MS            100    // Longest run() waits before checking whether it was stopped
+
+/// @brief State of a probed target
+enum MinuProbeState
+{
+  MINU_PROBE_UNKNOWN = 0,  // No echo has completed yet
+  MINU_PROBE_UP,           // The last echo was answered
+  MINU_PROBE_DOWN,         // MINU_PROBE_ATTEMPTS echoes in a row were lost, or the last could not be sent
+};
+
+/// @brief Result of probing a target, as given to the MinuProbeCallback
+struct MinuProbeResult
+{
+  uint8_t state;      // MinuProbeState
+  uint16_t lost;      // Echoes lost in a row
+  uint32_t rttMs;     // Round-trip time of the last echo answered
+  uint32_t nextMs;    // Time until the next echo is sent
+  uint32_t sent;      // Echoes sent since the engine was started
+  uint32_t received;  // Replies received since the engine was started
+};
+
+/// @brief        Function given a target's result whenever an echo to it is answered or it is found unreachable
+/// @param target Index of the target, in the order the targets were added
+/// @param result Result of the target
+/// @param arg    User-defined argument registered along with the function
+/// @note         Called from the task running the engine
+typedef void (*MinuProbeCallback)(size_t target, const MinuProbeResult &result, void *arg);
+
+/// @brief Probes up to MINU_PROBE_TARGET_MAX hosts concurrently. See the top of this file for details.
+/// @note  All members must be called from the task running the engine, except start() and stop()
+template <class Transport, class Clock = MinuSystemClock>
+class MinuProbeEngine
+{
+
+public:
+  MinuProbeEngine(const Transport &transport = Transport()) : _transport(transport)
+  {
+    this->_count = 0;
+    this->_backoffMaxMs = MINU_PROBE_BACKOFF_MAX_MS;
+    this->_cb = NULL;
+    this->_cbArg = NULL;
+    this->_running.store(false);
+    this->_restart.store(false);
+  }
+
+  /// @brief  Add a target to probe
+  /// @param  host       Host name or address, copied. Its format is up to the transport
+  /// @param  intervalMs Interval between echoes while the target is reachable
+  /// @param  timeoutMs  Time after which an echo is lost
+  /// @return Index of the target, or -1 if there are already MINU_PROBE_TARGET_MAX targets
+  ssize_t addTarget(const char *host, uint32_t intervalMs = MINU_PROBE_INTERVAL_MS,
+                    uint32_t timeoutMs = MINU_PROBE_TIMEOUT_MS)
+  {
+    if (!host || this->_count >= MINU_PROBE_TARGET_MAX)
+      return -1;
+
+    Target &target = this->_targets[this->_count];
+    this->_transport.forget(this->_count);
+    snprintf(target.host, sizeof(target.host), "%s", host);
+    target.intervalMs = intervalMs;
+    target.timeoutMs = timeoutMs;
+    target.sequence = 0;
+    this->_reset(target, this->_clock.now());
+    return this->_count++;
+  }
+
+  /// @brief Remove all targets
+  void removeAllTargets(void)
+  {
+    for (size_t i = 0; i < this->_count; ++i)
+      this->_transport.forget(i);
+    this->_count = 0;
+  }
+
+  /// @brief Returns the number of targets
+  size_t targetCount() const { return this->_count; }
+
+  /// @brief Returns the result of a target
+  const MinuProbeResult &result(size_t target) const { return this->_targets[target].result; }
+
+  /// @brief Set the function given each result. See MinuProbeCallback
+  void setCallback(MinuProbeCallback cb, void *arg = NULL)
+  {
+    this->_cb = cb;
+    this->_cbArg = arg;
+  }
+
+  /// @brief Set the longest interval between echoes to an unreachable target
+  void setBackoffMax(uint32_t ms) { this->_backoffMaxMs = ms; }
+
+  /// @brief Returns the transport used to send echoes
+  Transport &transport() { return this->_transport; }
+
+  /// @brief  Send the echoes that are due, then wait for replies until the next echo is due or lost
+  /// @param  maxWaitMs Longest time to wait for replies
+  /// @return Number of results given to the callback
+  size_t poll(uint32_t maxWaitMs)
+  {
+    uint32_t now = this->_clock.now();
+    if (this->_restart.exchange(false))
+    {
+      for (size_t i = 0; i < this->_count; ++i)
+        this->_reset(this->_targets[i], now);
+    }
+
+    size_t published = 0;
+    uint32_t wait = maxWaitMs;
+    for (size_t i = 0; i < this->_count; ++i)
+    {
+      Target &target = this->_targets[i];
+      if (target.inFlight)
+      {
+        int32_t left = (int32_t)(target.sentAt + target.timeoutMs - now);
+        if (left > 0)
+        {
+          wait = (wait < (uint32_t)left) ? wait : left;
+          continue;
+        }
+        target.inFlight = false;
+        published += this->_lost(i, now, false);
+      }
+
+      // A lost echo is retried at once, so the target may be due again already
+      int32_t left = (int32_t)(target.due - now);
+      if (left > 0)
+      {
+        wait = (wait < (uint32_t)left) ? wait : left;
+        continue;
+      }
+
+      target.sequence++;
+      if (this->_transport.send(i, target.host, target.sequence))
+      {
+        target.result.sent++;
+        target.inFlight = true;
+        target.sentAt = now;
+        wait = (wait < target.timeoutMs) ? wait : target.timeoutMs;
+      }
+      else
+      {
+        published += this->_lost(i, now, true);
+        wait = (wait < target.result.nextMs) ? wait : target.result.nextMs;
+      }
+    }
+
+    size_t index;
+    uint16_t sequence;
+    for (bool received = this->_transport.receive(index, sequence, wait); received;
+         received = this->_transport.receive(index, sequence, 0))
+    {
+      // Late replies to echoes already counted as lost are ignored
+      if (index < this->_count && this->_targets[index].inFlight && sequence == this->_targets[index].sequence)
+        published += this->_answered(index, this->_clock.now());
+    }
+    return published;
+  }
+
+  /// @brief Call poll() until stop() is called
+  /// @note  Call start() first, from any task
+  void run(void)
+  {
+    while (this->_running.load())
+      this->poll(MINU_PROBE_POLL_MS);
+  }
+
+  /// @brief Forget all results and probe every target at once, and let run() run
+  /// @note  Safe to call from any task. The results are reset by the task running the engine
+  void start(void)
+  {
+    this->_restart.store(true);
+    this->_running.store(true);
+  }
+
+  /// @brief Make run() return within MINU_PROBE_POLL_MS
+  /// @note  Safe to call from any task
+  void stop(void) { this->_running.store(false); }
+
+  /// @brief Whether run() should be running
+  bool running() const { return this->_running.load(); }
+
+private:
+  struct Target
+  {
+    char host[MINU_PROBE_HOST_LEN];
+    uint32_t intervalMs;
+    uint32_t timeoutMs;
+    uint32_t backoffMs;  // Interval before the next echo if the target is found unreachable
+    uint32_t due;        // Time the next echo is sent
+    uint32_t sentAt;     // Time the echo in flight was sent
+    uint16_t sequence;   // Sequence number of the last echo sent, never reset so that late replies are ignored
+    bool inFlight;
+    MinuProbeResult result;
+  };
+
+  void _reset(Target &target, uint32_t now)
+  {
+    target.backoffMs = target.intervalMs;
+    target.due = now;
+    target.inFlight = false;
+    memset(&target.result, 0, sizeof(target.result));
+  }
+
+  /// @brief Count a lost echo, and report the target unreachable if it has lost too many, or if \a giveUp
+  /// @return 1, if the callback was called
+  size_t _lost(size_t index, uint32_t now, bool giveUp)
+  {
+    Target &target = this->_targets[index];
+    target.result.lost++;
+    // Targets already unreachable are not retried until their backoff expires
+    if (!giveUp && target.result.state != MINU_PROBE_DOWN && target.result.lost < MINU_PROBE_ATTEMPTS)
+    {
+      target.due = now;
+      return 0;
+    }
+
+    target.result.state = MINU_PROBE_DOWN;
+    target.result.nextMs = target.backoffMs;
+    target.due = now + target.backoffMs;
+    target.backoffMs = (target.backoffMs < this->_backoffMaxMs / 2) ? target.backoffMs * 2 : this->_backoffMaxMs;
+    if (this->_cb)
+      this->_cb(index, target.result, this->_cbArg);
+    return 1;
+  }
+
+  /// @return 1, if the callback was called
+  size_t _answered(size_t index, uint32_t now)
+  {
+    Target &target = this->_targets[index];
+    target.inFlight = false;
+    target.result.state = MINU_PROBE_UP;
+    target.result.lost = 0;
+    target.result.rttMs = now - target.sentAt;
+    target.result.received++;
+    // Echoes are sent every intervalMs, however long each took to be answered. A reply slower than that makes the
+    // target due at once
+    target.due = target.sentAt + target.intervalMs;
+    target.result.nextMs = ((int32_t)(target.due - now) > 0) ? target.due - now : 0;
+    target.backoffMs = target.intervalMs;
+    if (this->_cb)
+      this->_cb(index, target.result, this->_cbArg);
+    return 1;
+  }
+
+  Transport _transport;
+  Clock _clock;
+  Target _targets[MINU_PROBE_TARGET_MAX];
+  size_t _count;
+  uint32_t _backoffMaxMs;
+  MinuProbeCallback _cb;
+  void *_cbArg;
+  std::atomic<bool> _running;
+  std::atomic<bool> _restart;
+};
+
+#if defined(ESP_PLATFORM) || defined(__linux__)
+/// @brief Transport sending ICMP echo requests, or UDP datagrams to echo servers, through BSD sockets
+/// @note  Host names are resolved on the first echo sent to them, which blocks until the DNS server answers
+class MinuSocketTransport
+{
+
+public:
+  /// @param udpPort 0, to send ICMP echo requests. Otherwise, echoes are sent as UDP datagrams to this port, or to the
+  ///                port given in the host name as "host:port"
+  MinuSocketTransport(uint16_t udpPort = 0)
+  {
+    this->_udpPort = udpPort;
+    this->_fd = -1;
+    this->_ipHeaders = true;
+    for (size_t i = 0; i < MINU_PROBE_TARGET_MAX; ++i)
+      this->_resolved[i] = false;
+  }
+
+  /// @brief Copy the settings of another transport, but not its socket, which is opened on the first echo sent
+  MinuSocketTransport(const MinuSocketTransport &other) : MinuSocketTransport(other._udpPort) {}
+
+  ~MinuSocketTransport()
+  {
+    if (this->_fd >= 0)
+      close(this->_fd);
+  }
+
+  bool send(size_t target, const char *host, uint16_t sequence)
+  {
+    if (target >= MINU_PROBE_TARGET_MAX || !this->_open() || !this->_resolve(target, host))
+      return false;
+
+    uint8_t packet[ICMP_HEADER_LEN + PAYLOAD_LEN];
+    uint8_t *payload = packet;
+    size_t len = PAYLOAD_LEN;
+    if (!this->_udpPort)
+    {
+      // Type 8 is an echo request. Linux ping sockets set the identifier themselves
+      packet[0] = 8;
+      packet[1] = 0;
+      packet[2] = packet[3] = 0;
+      packet[4] = ICMP_IDENTIFIER >> 8;
+      packet[5] = ICMP_IDENTIFIER & 0xFF;
+      packet[6] = sequence >> 8;
+      packet[7] = sequence & 0xFF;
+      payload = packet + ICMP_HEADER_LEN;
+      len += ICMP_HEADER_LEN;
+    }
+    uint32_t magic = MAGIC;
+    uint16_t index = target;
+    memcpy(payload, &magic, sizeof(magic));
+    memcpy(payload + 4, &index, sizeof(index));
+    memcpy(payload + 6, &sequence, sizeof(sequence));
+    if (!this->_udpPort)
+    {
+      uint16_t checksum = _checksum(packet, len);
+      packet[2] = checksum >> 8;
+      packet[3] = checksum & 0xFF;
+    }
+
+    if (sendto(this->_fd, packet, len, 0, (struct sockaddr *)&this->_addresses[target], sizeof(struct sockaddr_in)) < 0)
+    {
+      // The host is resolved again on the next echo, in case its address changed
+      this->_resolved[target] = false;
+      return false;
+    }
+    return true;
+  }
+
+  /// @brief Forget the address of a target, so that it is resolved again on the next echo sent to it
+  void forget(size_t target)
+  {
+    if (target < MINU_PROBE_TARGET_MAX)
+      this->_resolved[target] = false;
+  }
+
+  bool receive(size_t &target, uint16_t &sequence, uint32_t timeoutMs)
+  {
+    if (this->_fd < 0)
+      return false;
+
+    fd_set fds;
+    FD_ZERO(&fds);
+    FD_SET(this->_fd, &fds);
+    struct timeval timeout;
+    timeout.tv_sec = timeoutMs / 1000;
+    timeout.tv_usec = (timeoutMs % 1000) * 1000;
+    if (select(this->_fd + 1, &fds, NULL, NULL, &timeout) <= 0)
+      return false;
+
+    // Packets that are not replies to our echoes, e.g. replies to another pinger on a raw socket, are skipped
+    uint8_t packet[128];
+    ssize_t len;
+    while ((len = recv(this->_fd, packet, sizeof(packet), MSG_DONTWAIT)) >= 0)
+    {
+      const uint8_t *payload = packet;
+      if (!this->_udpPort)
+      {
+        // Raw sockets receive the IP header too
+        if (this->_ipHeaders && len > 0 && (packet[0] >> 4) == 4)
+        {
+          size_t ipLen = (packet[0] & 0x0F) * 4;
+          payload += ipLen;
+          len -= ipLen;
+        }
+        // Type 0 is an echo reply
+        if (len < (ssize_t)ICMP_HEADER_LEN || payload[0] != 0)
+          continue;
+        payload += ICMP_HEADER_LEN;
+        len -= ICMP_HEADER_LEN;
+      }
+
+      uint32_t magic;
+      uint16_t index;
+      if (len < (ssize_t)PAYLOAD_LEN)
+        continue;
+      memcpy(&magic, payload, sizeof(magic));
+      memcpy(&index, payload + 4, sizeof(index));
+      if (magic != MAGIC)
+        continue;
+      memcpy(&sequence, payload + 6, sizeof(sequence));
+      target = index;
+      return true;
+    }
+    return false;
+  }
+
+private:
+  static const uint32_t MAGIC = 0x756E694D;           // "Minu", at the start of the payload of every echo
+  static const uint16_t ICMP_IDENTIFIER = 0x4D49;
+  static const size_t ICMP_HEADER_LEN = 8;
+  static const size_t PAYLOAD_LEN = 8;                // Magic, target and sequence
+
+  /// @brief Open the socket, if it is not open yet
+  bool _open(void)
+  {
+    if (this->_fd >= 0)
+      return true;
+
+    if (this->_udpPort)
+      this->_fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    else
+    {
+#ifdef __linux__
+      // Ping sockets don't need privileges, if the user's group is in net.ipv4.ping_group_range. They only receive
+      // replies to their own echoes, without the IP header
+      this->_fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_ICMP);
+      this->_ipHeaders = (this->_fd < 0);
+      if (this->_fd < 0)
+#endif
+        this->_fd = socket(AF_INET, SOCK_RAW, IPPROTO_ICMP);
+    }
+    return this->_fd >= 0;
+  }
+
+  /// @brief Look up the address of a target, if it is not known yet
+  bool _resolve(size_t target, const char *host)
+  {
+    if (this->_resolved[target])
+      return true;
+
+    char name[MINU_PROBE_HOST_LEN];
+    snprintf(name, sizeof(name), "%s", host);
+    uint16_t port = this->_udpPort;
+    char *colon = strrchr(name, ':');
+    if (this->_udpPort && colon)
+    {
+      *colon = 0;
+      port = atoi(colon + 1);
+    }
+
+    struct sockaddr_in &address = this->_addresses[target];
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    if (!inet_aton(name, &address.sin_addr))
+    {
+      struct addrinfo hints;
+      struct addrinfo *info = NULL;
+      memset(&hints, 0, sizeof(hints));
+      hints.ai_family = AF_INET;
+      if (getaddrinfo(name, NULL, &hints, &info) || !info)
+        return false;
+      address.sin_addr = ((struct sockaddr_in *)info->ai_addr)->sin_addr;
+      freeaddrinfo(info);
+    }
+    this->_resolved[target] = true;
+    return true;
+  }
+
+  /// @brief Returns the Internet checksum of a packet
+  static uint16_t _checksum(const uint8_t *data, size_t len)
+  {
+    uint32_t sum = 0;
+    for (size_t i = 0; i + 1 < len; i += 2)
+      sum += (data[i] << 8) | data[i + 1];
+    if (len & 1)
+      sum += data[len - 1] << 8;
+    while (sum >> 16)
+      sum = (sum & 0xFFFF) + (sum >> 16);
+    return ~sum;
+  }
+
+  uint16_t _udpPort;
+  int _fd;
+  bool _ipHeaders;  // Whether replies come with their IP header, as on raw sockets
+  bool _resolved[MINU_PROBE_TARGET_MAX];
+  struct sockaddr_in _addresses[MINU_PROBE_TARGET_MAX];
+};
+#endif
+
+#endif
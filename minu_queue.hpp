@@ -0,0 +1,108 @@
+/*
+ * @file  minu_queue.hpp
+ * @brief Bounded lock-free queue used to pass events between tasks, interrupts and the Minu event loop.
+ *
+ */
+
+#ifndef _LIBMINU_QUEUE_H_
+#define _LIBMINU_QUEUE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+/// @brief Fixed-capacity multi-producer multi-consumer FIFO queue.
+/// @note  Based on Dmitry Vyukov's bounded MPMC queue: each slot carries a sequence number that tells
+///        producers and consumers whether it is free or filled, so no locks are taken and push() may be
+///        called from an interrupt. Only 32-bit atomics are used, which are lock-free on the ESP32.
+/// @note  \a N must be a power of two, and \a T should be cheap to copy.
+template <class T, size_t N>
+class MinuQueue
+{
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "MinuQueue capacity must be a power of two");
+
+public:
+  MinuQueue()
+  {
+    for (size_t i = 0; i < N; ++i)
+      this->_slots[i].seq.store(i, std::memory_order_relaxed);
+    this->_head.store(0, std::memory_order_relaxed);
+    this->_tail.store(0, std::memory_order_relaxed);
+  }
+
+  /// @brief  Append a value to the back of the queue
+  /// @return false, if the queue is full
+  bool push(const T &value)
+  {
+    uint32_t pos = this->_head.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      Slot &slot = this->_slots[pos & (N - 1)];
+      uint32_t seq = slot.seq.load(std::memory_order_acquire);
+      int32_t diff = (int32_t)(seq - pos);
+      if (diff == 0)
+      {
+        // The slot is free. Claim it unless another producer got there first
+        if (this->_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          slot.value = value;
+          slot.seq.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0)
+        return false;
+      else
+        pos = this->_head.load(std::memory_order_relaxed);
+    }
+  }
+
+  /// @brief  Remove the value at the front of the queue
+  /// @return false, if the queue is empty
+  bool pop(T &value)
+  {
+    uint32_t pos = this->_tail.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      Slot &slot = this->_slots[pos & (N - 1)];
+      uint32_t seq = slot.seq.load(std::memory_order_acquire);
+      int32_t diff = (int32_t)(seq - (pos + 1));
+      if (diff == 0)
+      {
+        if (this->_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          value = slot.value;
+          slot.seq.store(pos + N, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0)
+        return false;
+      else
+        pos = this->_tail.load(std::memory_order_relaxed);
+    }
+  }
+
+  /// @brief Whether the queue currently holds no values
+  /// @note  The result may be stale by the time it is used if other tasks are pushing or popping concurrently
+  bool empty() const
+  {
+    return this->_head.load(std::memory_order_acquire) == this->_tail.load(std::memory_order_acquire);
+  }
+
+  /// @brief Returns the maximum number of values the queue can hold
+  static size_t capacity() { return N; }
+
+private:
+  struct Slot
+  {
+    std::atomic<uint32_t> seq;
+    T value;
+  };
+
+  Slot _slots[N];
+  std::atomic<uint32_t> _head;
+  std::atomic<uint32_t> _tail;
+};
+
+#endif
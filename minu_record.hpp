@@ -0,0 +1,597 @@
+/*
+ * @file  minu_record.hpp
+ * @brief Records a Minu session as a compact log that a host tool can replay deterministically.
+ *
+ * The recorder observes every frame rendered by a Minu, and just before each one logs how the menu differs from
+ * the previous frame: the page shown, its items, the highlight and the canvas. With its input handler installed on a
+ * MinuEventLoop, it also logs the inputs and link invocations that led there. Replaying the log on a host
+ * (extras/replay) reproduces the same sequence of frames regardless of button timing, task scheduling or the data
+ * sources the device read, so that the render cost of two builds can be compared on identical workloads.
+ *
+ * Log layout ("varint" is unsigned LEB128, "string" is a varint length followed by that many bytes):
+ *
+ *   Each record starts with
+ *     type       1 byte   MinuRecordType
+ *     delta      varint   Milliseconds since the previous record
+ *
+ *   followed by, depending on the type:
+ *     HEADER      magic 'M' 'N' 'R', version                1 byte each
+ *                 main text length, aux text length,        2 bytes each (little-endian)
+ *                 render count
+ *                 flags                                     1 byte, MINU_RECORD_FLAG_PALETTE
+ *     INPUT       event                                     1 byte
+ *     LINK        item index                                varint
+ *     PAGE        page id, info mode, item count, title     varint, 1 byte, varint, string
+ *     ITEM        item index, fore, back, main text, aux    varint, 2 bytes each (little-endian), string, string
+ *     HIGHLIGHT   item index + 1 (0 if there is none)       varint
+ *     CANVAS_SIZE cols, rows                                varint each
+ *     CANVAS_RUN  row, col, fore, back, characters          varint each, 2 bytes each, string
+ *     FRAME       partial                                   1 byte
+ *     PALETTE     RGB565 colours                            2 bytes each, MINU_PALETTE_SIZE of them
+ *
+ * A PAGE record is followed by ITEM records for every item, a HIGHLIGHT record and, for info pages, CANVAS_RUN
+ * records for the whole canvas. After that, only the items and canvas rows that changed are recorded. Changes are
+ * detected by comparing hashes, so the recorder only keeps MINU_RECORD_ITEMS_MAX + MINU_RECORD_ROWS_MAX words of
+ * state. Items and rows beyond those are recorded every frame.
+ *
+ * A log recorded with MINU_PALETTE has MINU_RECORD_FLAG_PALETTE set, and its colours are indices into the palette of
+ * the menu's backend. A PALETTE record holding that palette comes before the first frame, and again whenever the
+ * palette changed, after which every item and canvas row is recorded again. A reader built without MINU_PALETTE
+ * resolves the indices to RGB565, so that records carry RGB565 colours either way. A reader built with MINU_PALETTE
+ * only reads logs recorded with it.
+ */
+
+#ifndef _LIBMINU_RECORD_H_
+#define _LIBMINU_RECORD_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#include "minu.hpp"
+#include "minu_loop.hpp"
+
+#define MINU_RECORD_VERSION     3
+#define MINU_RECORD_FLAG_PALETTE 0x01  // Header flag set when colours are palette indices
+#define MINU_RECORD_BUFFER_LEN  256  // Number of bytes collected before they are passed to the write function
+#define MINU_RECORD_ITEMS_MAX   32   // Number of items per page whose changes are tracked
+#define MINU_RECORD_ROWS_MAX    16   // Number of canvas rows whose changes are tracked
+
+/// @brief Types of records in a session log
+enum MinuRecordType
+{
+  MINU_RECORD_HEADER = 1,
+  MINU_RECORD_INPUT,
+  MINU_RECORD_LINK,
+  MINU_RECORD_PAGE,
+  MINU_RECORD_ITEM,
+  MINU_RECORD_HIGHLIGHT,
+  MINU_RECORD_CANVAS_SIZE,
+  MINU_RECORD_CANVAS_RUN,
+  MINU_RECORD_FRAME,
+  MINU_RECORD_PALETTE,
+};
+
+/// @brief      Function used by the recorder to store or transmit part of the log
+/// @param data Log bytes
+/// @param len  Number of bytes
+/// @param arg  User-defined argument registered along with the function
+typedef void (*MinuRecordWriteFunction)(const uint8_t *data, size_t len, void *arg);
+
+/// @brief Records the session of a Minu. See the top of this file for details.
+/// @note  Register the recorder with setRenderObserver(), and its inputHandler() with MinuEventLoop::setInputHandler().
+///        Another observer, e.g. a MinuMirrorEncoder, can be chained behind it with setNextObserver()
+/// @note  With MINU_PALETTE, the backend must provide palette(), as MinuFunctionBackend does
+template <class Backend = MinuFunctionBackend, class Clock = MinuSystemClock>
+class MinuRecorder : public MinuRenderObserver
+{
+
+public:
+  /// @brief Class constructor
+  /// @param menu        Menu to record
+  /// @param renderCount Number of items rendered per frame, as passed to render()
+  /// @param write       Function used to store the log
+  /// @param arg         User-defined argument passed to \a write
+  MinuRecorder(MinuBasic<Backend> &menu, uint16_t renderCount, MinuRecordWriteFunction write, void *arg = NULL)
+      : _menu(menu)
+  {
+    this->_renderCount = renderCount;
+    this->_write = write;
+    this->_writeArg = arg;
+    this->_next = NULL;
+    this->_len = 0;
+    this->_started = false;
+    this->_lastTime = 0;
+    this->_pageId = -1;
+    this->_highlightedIndex = -1;
+    this->_canvasCols = 0;
+    this->_canvasRows = 0;
+#ifdef MINU_PALETTE
+    this->_paletteRecorded = false;
+#endif
+  }
+
+  /// @brief Set an observer that is passed every notification after the recorder
+  void setNextObserver(MinuRenderObserver *next) { this->_next = next; }
+
+  /// @brief  Input handler that records each input before the loop handles it
+  /// @param  arg Pointer to the recorder
+  /// @return false, so that the loop goes on to handle the input
+  static bool inputHandler(uint8_t event, void *arg)
+  {
+    MinuRecorder *recorder = (MinuRecorder *)arg;
+    recorder->_record(MINU_RECORD_INPUT);
+    recorder->_put(event);
+
+    MinuPage *page = recorder->_menu.currentPage();
+    if (event == MINU_INPUT_SELECT && page && page->highlightedIndex() >= 0)
+    {
+      recorder->_record(MINU_RECORD_LINK);
+      recorder->_putVarint(page->highlightedIndex());
+    }
+    return false;
+  }
+
+  /// @brief Pass the recorded bytes that are still buffered to the write function
+  void flush(void)
+  {
+    if (this->_len && this->_write)
+      this->_write(this->_buffer, this->_len, this->_writeArg);
+    this->_len = 0;
+  }
+
+  void frameStarted(ssize_t pageId, ssize_t highlightedIndex, bool partial)
+  {
+    this->_recordChanges(pageId, highlightedIndex);
+    this->_record(MINU_RECORD_FRAME);
+    this->_put(partial);
+    if (this->_next)
+      this->_next->frameStarted(pageId, highlightedIndex, partial);
+  }
+
+  void cursorMoved(uint16_t col, uint16_t row)
+  {
+    if (this->_next)
+      this->_next->cursorMoved(col, row);
+  }
+
+  void fragmentPrinted(const char *msg, uint16_t len, uint16_t fore, uint16_t back, bool inverted)
+  {
+    if (this->_next)
+      this->_next->fragmentPrinted(msg, len, fore, back, inverted);
+  }
+
+  void frameFinished(void)
+  {
+    this->flush();
+    if (this->_next)
+      this->_next->frameFinished();
+  }
+
+private:
+  /// @brief Record how the menu differs from when the last frame started
+  void _recordChanges(ssize_t pageId, ssize_t highlightedIndex)
+  {
+    MinuPage *page = this->_menu.currentPage();
+    if (!page)
+      return;
+
+#ifdef MINU_PALETTE
+    // The colours recorded so far were resolved through the old palette, so everything is recorded again
+    const MinuPalette &palette = this->_menu.backend().palette();
+    if (!this->_paletteRecorded || palette != this->_palette)
+    {
+      this->_record(MINU_RECORD_PALETTE);
+      for (uint8_t i = 0; i < MINU_PALETTE_SIZE; ++i)
+        this->_putU16(palette.colour(i));
+      this->_palette = palette;
+      this->_paletteRecorded = true;
+      memset(this->_itemHashes, 0, sizeof(this->_itemHashes));
+      memset(this->_rowHashes, 0, sizeof(this->_rowHashes));
+    }
+#endif
+
+    size_t itemCount = page->getItemCount();
+    uint32_t pageHash = _hash(page->title(), 0x811C9DC5) ^ (uint32_t)itemCount;
+    if (pageId != this->_pageId || pageHash != this->_pageHash)
+    {
+      this->_record(MINU_RECORD_PAGE);
+      this->_putVarint(pageId);
+      this->_put(page->infoMode());
+      this->_putVarint(itemCount);
+      this->_putString(page->title());
+      this->_pageId = pageId;
+      this->_pageHash = pageHash;
+      this->_highlightedIndex = -2;
+      memset(this->_itemHashes, 0, sizeof(this->_itemHashes));
+      memset(this->_rowHashes, 0, sizeof(this->_rowHashes));
+    }
+
+    // The items of a source are read on demand, so only those in the rendered window are recorded
+    size_t first = 0, last = itemCount;
+    if (page->itemSource())
+    {
+      first = (highlightedIndex > 0) ? highlightedIndex : 0;
+      last = (first + this->_renderCount < itemCount) ? first + this->_renderCount : itemCount;
+    }
+
+    for (size_t i = first; i < last; ++i)
+    {
+      const MinuPageItem *item = page->item(i);
+      if (!item)
+        continue;
+      uint32_t colours = item->auxTextColours();
+      uint32_t hash = _hash(item->auxText(), _hash(item->mainText(), 0x811C9DC5 ^ colours)) | 1;
+      if (i < MINU_RECORD_ITEMS_MAX && hash == this->_itemHashes[i])
+        continue;
+
+      this->_record(MINU_RECORD_ITEM);
+      this->_putVarint(i);
+      this->_putU16(colours & 0xFFFF);
+      this->_putU16(colours >> 16);
+      this->_putString(item->mainText());
+      this->_putString(item->auxText());
+      if (i < MINU_RECORD_ITEMS_MAX)
+        this->_itemHashes[i] = hash;
+    }
+
+    if (highlightedIndex != this->_highlightedIndex)
+    {
+      this->_record(MINU_RECORD_HIGHLIGHT);
+      this->_putVarint(highlightedIndex + 1);
+      this->_highlightedIndex = highlightedIndex;
+    }
+
+    if (page->infoMode())
+      this->_recordCanvas();
+  }
+
+  void _recordCanvas(void)
+  {
+    const MinuCellGrid &content = this->_menu.canvas().content();
+    if (content.cols() != this->_canvasCols || content.rows() != this->_canvasRows)
+    {
+      this->_record(MINU_RECORD_CANVAS_SIZE);
+      this->_putVarint(content.cols());
+      this->_putVarint(content.rows());
+      this->_canvasCols = content.cols();
+      this->_canvasRows = content.rows();
+      memset(this->_rowHashes, 0, sizeof(this->_rowHashes));
+    }
+
+    for (uint16_t r = 0; r < content.rows(); ++r)
+    {
+      const MinuCell *cells = content.row(r);
+      uint32_t hash = _hash(cells, content.cols()) | 1;
+      if (r < MINU_RECORD_ROWS_MAX && hash == this->_rowHashes[r])
+        continue;
+      if (r < MINU_RECORD_ROWS_MAX)
+        this->_rowHashes[r] = hash;
+
+      // The whole row is recorded as runs of cells sharing one colour pair
+      for (uint16_t c = 0; c < content.cols();)
+      {
+        uint16_t end = c + 1;
+        while (end < content.cols() && cells[end].fore == cells[c].fore && cells[end].back == cells[c].back)
+          end++;
+
+        this->_record(MINU_RECORD_CANVAS_RUN);
+        this->_putVarint(r);
+        this->_putVarint(c);
+        this->_putU16(cells[c].fore);
+        this->_putU16(cells[c].back);
+        this->_putVarint(end - c);
+        for (uint16_t i = c; i < end; ++i)
+          this->_put(cells[i].ch);
+        c = end;
+      }
+    }
+  }
+
+  /// @brief Start a record, preceded by the log header if this is the first
+  void _record(uint8_t type)
+  {
+    uint32_t now = this->_clock.now();
+    if (!this->_started)
+    {
+      this->_started = true;
+      this->_lastTime = now;
+      const uint8_t header[] = {MINU_RECORD_HEADER, 0, 'M', 'N', 'R', MINU_RECORD_VERSION};
+      for (size_t i = 0; i < sizeof(header); ++i)
+        this->_put(header[i]);
+      this->_putU16(this->_menu.mainTextLength());
+      this->_putU16(this->_menu.auxTextLength());
+      this->_putU16(this->_renderCount);
+#ifdef MINU_PALETTE
+      this->_put(MINU_RECORD_FLAG_PALETTE);
+#else
+      this->_put(0);
+#endif
+    }
+
+    this->_put(type);
+    this->_putVarint(now - this->_lastTime);
+    this->_lastTime = now;
+  }
+
+  /// @brief FNV-1a hash of a string
+  static uint32_t _hash(const char *text, uint32_t hash)
+  {
+    while (text && *text)
+      hash = (hash ^ (uint8_t)*text++) * 0x01000193;
+    return hash;
+  }
+
+  /// @brief FNV-1a hash of a row of cells
+  static uint32_t _hash(const MinuCell *cells, uint16_t count)
+  {
+    uint32_t hash = 0x811C9DC5;
+    for (uint16_t i = 0; i < count; ++i)
+    {
+      hash = (hash ^ (uint8_t)cells[i].ch) * 0x01000193;
+      hash = (hash ^ ((uint32_t)cells[i].fore << 16 | cells[i].back)) * 0x01000193;
+    }
+    return hash;
+  }
+
+  void _put(uint8_t b)
+  {
+    if (this->_len == MINU_RECORD_BUFFER_LEN)
+      this->flush();
+    this->_buffer[this->_len++] = b;
+  }
+
+  void _putU16(uint16_t v)
+  {
+    this->_put(v & 0xFF);
+    this->_put(v >> 8);
+  }
+
+  void _putVarint(uint32_t v)
+  {
+    while (v >= 0x80)
+    {
+      this->_put((v & 0x7F) | 0x80);
+      v >>= 7;
+    }
+    this->_put(v);
+  }
+
+  void _putString(const char *text)
+  {
+    size_t len = (text) ? strlen(text) : 0;
+    this->_putVarint(len);
+    for (size_t i = 0; i < len; ++i)
+      this->_put(text[i]);
+  }
+
+  MinuBasic<Backend> &_menu;
+  Clock _clock;
+  uint16_t _renderCount;
+  MinuRecordWriteFunction _write;
+  void *_writeArg;
+  MinuRenderObserver *_next;
+  uint8_t _buffer[MINU_RECORD_BUFFER_LEN];
+  size_t _len;
+  bool _started;
+  uint32_t _lastTime;
+  ssize_t _pageId;
+  uint32_t _pageHash;
+  ssize_t _highlightedIndex;
+  uint32_t _itemHashes[MINU_RECORD_ITEMS_MAX];
+  uint16_t _canvasCols;
+  uint16_t _canvasRows;
+  uint32_t _rowHashes[MINU_RECORD_ROWS_MAX];
+#ifdef MINU_PALETTE
+  MinuPalette _palette;    // Palette last recorded
+  bool _paletteRecorded;
+#endif
+};
+
+/// @brief One record read from a session log
+/// @note  Text points into the buffer given to the reader and is not NUL-terminated
+struct MinuRecord
+{
+  uint8_t type;
+  uint32_t time;       // Milliseconds since the first record
+  uint8_t event;       // INPUT
+  bool flag;           // PAGE: info mode, FRAME: partial
+  ssize_t index;       // LINK, ITEM, HIGHLIGHT: item index. PAGE: page id. CANVAS_RUN: row
+  uint32_t value;      // PAGE: item count. CANVAS_RUN: column. CANVAS_SIZE: rows (cols in index)
+  uint16_t fore;       // ITEM, CANVAS_RUN. RGB565, or a palette index in MINU_PALETTE builds
+  uint16_t back;       // ITEM, CANVAS_RUN
+  const char *text;    // PAGE: title. ITEM: main text. CANVAS_RUN: characters
+  size_t textLen;
+  const char *aux;     // ITEM: auxiliary text
+  size_t auxLen;
+};
+
+/// @brief Reads the records of a session log held in memory
+class MinuRecordReader
+{
+
+public:
+  /// @brief Class constructor
+  /// @param data Log bytes, which must outlive the reader
+  /// @param len  Number of bytes in the log
+  MinuRecordReader(const uint8_t *data, size_t len)
+  {
+    this->_data = data;
+    this->_len = len;
+    this->_pos = 0;
+    this->_time = 0;
+    this->_error = false;
+    this->_mainTextLen = 0;
+    this->_auxTextLen = 0;
+    this->_renderCount = 0;
+    this->_paletted = false;
+
+    if (len < 13 || data[0] != MINU_RECORD_HEADER || data[2] != 'M' || data[3] != 'N' || data[4] != 'R' ||
+        data[5] != MINU_RECORD_VERSION)
+    {
+      this->_error = true;
+      return;
+    }
+    this->_mainTextLen = data[6] | data[7] << 8;
+    this->_auxTextLen = data[8] | data[9] << 8;
+    this->_renderCount = data[10] | data[11] << 8;
+    this->_paletted = data[12] & MINU_RECORD_FLAG_PALETTE;
+    this->_pos = 13;
+#ifdef MINU_PALETTE
+    // Indices cannot be made up for RGB565 colours
+    this->_error = !this->_paletted;
+#endif
+  }
+
+  /// @brief  Read the next record
+  /// @return false, at the end of the log or if it is malformed
+  bool next(MinuRecord &record)
+  {
+    if (this->_error || this->_pos >= this->_len)
+      return false;
+
+    memset(&record, 0, sizeof(record));
+    uint32_t delta = 0, v = 0;
+    record.type = this->_data[this->_pos++];
+    if (!this->_getVarint(delta))
+      return false;
+    this->_time += delta;
+    record.time = this->_time;
+
+    bool ok = true;
+    switch (record.type)
+    {
+    case MINU_RECORD_INPUT:
+      ok = this->_pos < this->_len;
+      if (ok)
+        record.event = this->_data[this->_pos++];
+      break;
+    case MINU_RECORD_LINK:
+      ok = this->_getVarint(v);
+      record.index = v;
+      break;
+    case MINU_RECORD_PAGE:
+      ok = this->_getVarint(v) && this->_pos < this->_len;
+      record.index = v;
+      if (ok)
+        record.flag = this->_data[this->_pos++];
+      ok = ok && this->_getVarint(record.value) && this->_getString(record.text, record.textLen);
+      break;
+    case MINU_RECORD_ITEM:
+      ok = this->_getVarint(v) && this->_getU16(record.fore) && this->_getU16(record.back) &&
+           this->_getString(record.text, record.textLen) && this->_getString(record.aux, record.auxLen);
+      record.index = v;
+      this->_resolve(record);
+      break;
+    case MINU_RECORD_HIGHLIGHT:
+      ok = this->_getVarint(v);
+      record.index = (ssize_t)v - 1;
+      break;
+    case MINU_RECORD_CANVAS_SIZE:
+      ok = this->_getVarint(v) && this->_getVarint(record.value);
+      record.index = v;
+      break;
+    case MINU_RECORD_CANVAS_RUN:
+      ok = this->_getVarint(v) && this->_getVarint(record.value) && this->_getU16(record.fore) &&
+           this->_getU16(record.back) && this->_getString(record.text, record.textLen);
+      record.index = v;
+      this->_resolve(record);
+      break;
+    case MINU_RECORD_FRAME:
+      ok = this->_pos < this->_len;
+      if (ok)
+        record.flag = this->_data[this->_pos++];
+      break;
+    case MINU_RECORD_PALETTE:
+      for (uint8_t i = 0; ok && i < MINU_PALETTE_SIZE; ++i)
+      {
+        uint16_t colour;
+        ok = this->_getU16(colour);
+        this->_palette.set(i, colour);
+      }
+      break;
+    default:
+      ok = false;
+    }
+
+    this->_error = !ok;
+    return ok;
+  }
+
+  /// @brief Whether the log was malformed
+  bool error() const { return this->_error; }
+
+  /// @brief Returns the length of the main text section of an item on the recorded device
+  uint16_t mainTextLength() const { return this->_mainTextLen; }
+
+  /// @brief Returns the length of the auxiliary text section of an item on the recorded device
+  uint16_t auxTextLength() const { return this->_auxTextLen; }
+
+  /// @brief Returns the number of items rendered per frame on the recorded device
+  uint16_t renderCount() const { return this->_renderCount; }
+
+  /// @brief Whether the log was recorded with MINU_PALETTE, so that its colours are palette indices
+  bool paletted() const { return this->_paletted; }
+
+  /// @brief Returns the palette of the last PALETTE record read
+  const MinuPalette &palette() const { return this->_palette; }
+
+private:
+  /// @brief Resolve the palette indices of a paletted log to RGB565, unless the reader keeps indices itself
+  void _resolve(MinuRecord &record) const
+  {
+#ifndef MINU_PALETTE
+    if (!this->_paletted)
+      return;
+    record.fore = this->_palette.colour(record.fore);
+    record.back = this->_palette.colour(record.back);
+#else
+    (void)record;
+#endif
+  }
+
+  bool _getVarint(uint32_t &v)
+  {
+    v = 0;
+    for (uint8_t shift = 0; shift < 35 && this->_pos < this->_len; shift += 7)
+    {
+      uint8_t b = this->_data[this->_pos++];
+      v |= (uint32_t)(b & 0x7F) << shift;
+      if (!(b & 0x80))
+        return true;
+    }
+    return false;
+  }
+
+  bool _getU16(uint16_t &v)
+  {
+    if (this->_pos + 2 > this->_len)
+      return false;
+    v = this->_data[this->_pos] | (uint16_t)this->_data[this->_pos + 1] << 8;
+    this->_pos += 2;
+    return true;
+  }
+
+  bool _getString(const char *&text, size_t &len)
+  {
+    uint32_t v;
+    if (!this->_getVarint(v) || v > this->_len - this->_pos)
+      return false;
+    text = (const char *)&this->_data[this->_pos];
+    len = v;
+    this->_pos += v;
+    return true;
+  }
+
+  const uint8_t *_data;
+  size_t _len;
+  size_t _pos;
+  uint32_t _time;
+  bool _error;
+  uint16_t _mainTextLen;
+  uint16_t _auxTextLen;
+  uint16_t _renderCount;
+  bool _paletted;
+  MinuPalette _palette;
+};
+
+#endif
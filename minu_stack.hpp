@@ -0,0 +1,100 @@
+/*
+ * @file  minu_stack.hpp
+ * @brief Measures the maximum stack depth reached by a piece of code, e.g. MinuBasic::render() or a callback.
+ *
+ * A MinuStackProbe paints a block of stack below its caller with a known pattern, the caller then runs the code being
+ * measured, and the probe counts how much of the pattern was overwritten. Since the painting and the counting are
+ * done by the same function called from the same place, both see the same block of stack, so this works the same on
+ * an ESP32 task as on a Linux thread and needs no support from the RTOS.
+ *
+ * The figure is a lower bound of the real maximum: code paths that were never taken while the probe was in use, and
+ * locals that happen to be written with the pattern itself, are not seen. Leave some margin when sizing a task stack
+ * from it.
+ */
+
+#ifndef _LIBMINU_STACK_H_
+#define _LIBMINU_STACK_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef MINU_STACK_PROBE_DEPTH
+#define MINU_STACK_PROBE_DEPTH    2048  // Bytes of stack painted below the caller. Must fit in the free stack
+#endif
+#define MINU_STACK_PROBE_PATTERN  0xA5  // Same fill byte as FreeRTOS, so painted stacks look alike in a debugger
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MINU_NOINLINE __attribute__((noinline))
+#else
+#define MINU_NOINLINE
+#endif
+
+/// @brief Measures the stack used by code run between paint() and measure()
+/// @note  paint() and measure() must be called from the same function, with the code being measured in between.
+///        The caller must have at least MINU_STACK_PROBE_DEPTH bytes of stack free, or painting will overflow it
+class MinuStackProbe
+{
+
+public:
+  MinuStackProbe() : _last(0), _max(0), _samples(0) {}
+
+  /// @brief Fill the stack below the caller with the pattern
+  void paint(void) { this->_probe(true); }
+
+  /// @brief  Count how much of the painted stack was used since paint() was called
+  /// @return The number of bytes used, or MINU_STACK_PROBE_DEPTH if the painted block was used up entirely
+  size_t measure(void)
+  {
+    this->_last = this->_probe(false);
+    if (this->_last > this->_max)
+      this->_max = this->_last;
+    this->_samples++;
+    return this->_last;
+  }
+
+  /// @brief Returns the depth measured by the last call to measure()
+  size_t lastDepth() const { return this->_last; }
+
+  /// @brief Returns the deepest stack measured since the probe was created or reset()
+  size_t maxDepth() const { return this->_max; }
+
+  /// @brief Returns the number of measurements taken since the probe was created or reset()
+  uint32_t samples() const { return this->_samples; }
+
+  /// @brief Whether any measurement used up the whole painted block, in which case maxDepth() is too small
+  bool saturated() const { return this->_max >= MINU_STACK_PROBE_DEPTH; }
+
+  void reset(void)
+  {
+    this->_last = 0;
+    this->_max = 0;
+    this->_samples = 0;
+  }
+
+private:
+  /// @brief  Paint or count the block of stack occupied by this function's frame
+  /// @note   Kept out of line and shared by both operations, so that the block lies at the same address both times
+  /// @return The number of bytes no longer holding the pattern, when counting
+  MINU_NOINLINE size_t _probe(bool paint)
+  {
+    volatile uint8_t block[MINU_STACK_PROBE_DEPTH];
+    if (paint)
+    {
+      for (size_t i = 0; i < sizeof(block); ++i)
+        block[i] = MINU_STACK_PROBE_PATTERN;
+      return 0;
+    }
+
+    // The stack grows downwards, so the deepest calls reach the start of the block last
+    size_t untouched = 0;
+    while (untouched < sizeof(block) && block[untouched] == MINU_STACK_PROBE_PATTERN)
+      untouched++;
+    return sizeof(block) - untouched;
+  }
+
+  size_t _last;
+  size_t _max;
+  uint32_t _samples;
+};
+
+#endif
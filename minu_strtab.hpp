@@ -0,0 +1,254 @@
+/*
+ * @file  minu_strtab.hpp
+ * @brief Compressed, randomly accessible tables of strings for large pick-lists, e.g. timezones.
+ *
+ * Each entry of a table is a text, shown as an item's main text, and an optional value, e.g. the POSIX string of a
+ * timezone. Tables are meant to be generated at build time (see extras/strtab) and kept in flash as const arrays.
+ *
+ * Texts are front-coded: each is stored as the length of the prefix it shares with the previous text and the rest of
+ * it. Every MINU_STRTAB_BUCKET_LEN entries, a text is stored in full and its offset recorded, so that decoding any
+ * entry only decodes the entries before it in its bucket. Sorted lists such as "America_Chicago", "America_Denver"
+ * shrink the most. Values are stored once each, so entries sharing a value (e.g. all "CET-1CEST,M3.5.0,M10.5.0/3"
+ * zones) only store its index.
+ *
+ * Texts layout, for each entry:
+ *
+ *   prefix  1 byte   Number of leading characters shared with the previous text, 0 for the first of a bucket
+ *   length  1 byte   Number of characters that follow
+ *   suffix  length bytes
+ *   value   2 bytes  Index of the entry's value (little-endian), or MINU_STRTAB_NO_VALUE
+ */
+
+#ifndef _LIBMINU_STRTAB_H_
+#define _LIBMINU_STRTAB_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "minu.hpp"
+
+#define MINU_STRTAB_BUCKET_LEN  16      // Entries per bucket. Decoding an entry decodes at most this many
+#define MINU_STRTAB_TEXT_MAX    64      // Longest text, including the NUL. Longer texts are truncated when added
+#define MINU_STRTAB_NO_VALUE    0xFFFF  // Value index of entries without a value
+
+/// @brief A compressed table of strings. See the top of this file for details.
+struct MinuStringTable
+{
+  uint16_t count;             // Number of entries
+  const uint32_t *buckets;    // Offset in texts of the first entry of each bucket
+  const uint8_t *texts;       // Front-coded texts and value indexes
+  uint16_t valueCount;        // Number of distinct values
+  const uint16_t *values;     // Offset in valueData of each distinct value
+  const char *valueData;      // Distinct values, each followed by a NUL
+};
+
+/// @brief  Decode the text of an entry
+/// @param  buff Buffer of at least MINU_STRTAB_TEXT_MAX characters
+/// @return false, if the index is invalid
+static inline bool minuStrtabText(const MinuStringTable &table, size_t index, char *buff)
+{
+  if (index >= table.count)
+    return false;
+
+  const uint8_t *p = table.texts + table.buckets[index / MINU_STRTAB_BUCKET_LEN];
+  size_t len = 0;
+  for (size_t i = 0; i <= index % MINU_STRTAB_BUCKET_LEN; ++i)
+  {
+    len = p[0] + p[1];
+    memcpy(buff + p[0], p + 2, p[1]);
+    p += 2 + p[1] + 2;
+  }
+  buff[len] = 0;
+  return true;
+}
+
+/// @brief  Returns the value of an entry
+/// @return NULL, if the index is invalid or the entry has no value
+static inline const char *minuStrtabValue(const MinuStringTable &table, size_t index)
+{
+  if (index >= table.count)
+    return NULL;
+
+  // The value index follows the text, so the entries before it in its bucket are skipped over
+  const uint8_t *p = table.texts + table.buckets[index / MINU_STRTAB_BUCKET_LEN];
+  for (size_t i = 0; i < index % MINU_STRTAB_BUCKET_LEN; ++i)
+    p += 2 + p[1] + 2;
+  uint16_t value = p[2 + p[1]] | (p[2 + p[1] + 1] << 8);
+  return (value < table.valueCount) ? table.valueData + table.values[value] : NULL;
+}
+
+/// @brief  Returns the index of the first entry with the given text
+/// @return -1, if there is none
+static inline ssize_t minuStrtabFind(const MinuStringTable &table, const char *text)
+{
+  char buff[MINU_STRTAB_TEXT_MAX];
+  for (size_t i = 0; i < table.count; ++i)
+    if (minuStrtabText(table, i, buff) && !strcmp(buff, text))
+      return i;
+  return -1;
+}
+
+/// @brief Item source showing the entries of a string table
+/// @note  Items are given their index in the table as their id, so that a link shared by all items can look up the
+///        selected entry's value with minuStrtabValue()
+class MinuStringTableSource : public MinuItemSource
+{
+
+public:
+  /// @param table     Table to show. Only the pointers to its arrays are copied
+  /// @param showValue Whether to show each entry's value as the item's auxiliary text
+  MinuStringTableSource(const MinuStringTable &table, bool showValue = false) : _table(table)
+  {
+    this->_showValue = showValue;
+    this->_link = NULL;
+    this->_highlightedCallback = NULL;
+  }
+
+  /// @brief Set the link and highlighted callback given to every item
+  void setCallbacks(MinuCallbackFunction link, MinuCallbackFunction highlightedCallback = NULL)
+  {
+    this->_link = link;
+    this->_highlightedCallback = highlightedCallback;
+  }
+
+  /// @brief Returns the table shown
+  const MinuStringTable &table() const { return this->_table; }
+
+  size_t itemCount() { return this->_table.count; }
+
+  MinuPageItem *loadItem(size_t index)
+  {
+    char text[MINU_STRTAB_TEXT_MAX];
+    if (!minuStrtabText(this->_table, index, text))
+      return NULL;
+
+    const char *value = (this->_showValue) ? minuStrtabValue(this->_table, index) : NULL;
+    this->_item = MinuPageItem(index, this->_link, text, value, this->_highlightedCallback);
+    return &this->_item;
+  }
+
+private:
+  MinuStringTable _table;
+  bool _showValue;
+  MinuCallbackFunction _link;
+  MinuCallbackFunction _highlightedCallback;
+  MinuPageItem _item;
+};
+
+/// @brief Builds a string table in RAM, e.g. for lists only known at runtime or to generate a table's source code
+/// @note  Entries are kept in the order they are added. Adding them sorted gives the best compression
+class MinuStringTableBuilder
+{
+
+public:
+  MinuStringTableBuilder() : _count(0) {}
+
+  /// @brief  Append an entry
+  /// @param  text  Text of the entry, truncated to MINU_STRTAB_TEXT_MAX - 1 characters
+  /// @param  value Value of the entry, or NULL
+  /// @return false, if the table is full
+  bool add(const char *text, const char *value = NULL)
+  {
+    if (this->_count >= 0xFFFF)
+      return false;
+
+    size_t len = strlen(text);
+    if (len > MINU_STRTAB_TEXT_MAX - 1)
+      len = MINU_STRTAB_TEXT_MAX - 1;
+
+    size_t prefix = 0;
+    if (this->_count % MINU_STRTAB_BUCKET_LEN)
+    {
+      while (prefix < len && prefix < this->_last.size() && this->_last[prefix] == text[prefix])
+        prefix++;
+    }
+    else
+      this->_buckets.push_back(this->_texts.size());
+
+    this->_texts.push_back(prefix);
+    this->_texts.push_back(len - prefix);
+    this->_texts.insert(this->_texts.end(), text + prefix, text + len);
+    uint16_t index = this->_valueIndex(value);
+    this->_texts.push_back(index & 0xFF);
+    this->_texts.push_back(index >> 8);
+
+    this->_last.assign(text, text + len);
+    this->_count++;
+    return true;
+  }
+
+  /// @brief Returns the table, which remains valid until the next entry is added
+  MinuStringTable table() const
+  {
+    MinuStringTable table = {(uint16_t)this->_count, this->_buckets.data(), this->_texts.data(),
+                             (uint16_t)this->_values.size(), this->_values.data(), this->_valueData.data()};
+    return table;
+  }
+
+  /// @brief Returns the number of bytes taken by the table's arrays
+  size_t size() const
+  {
+    return sizeof(MinuStringTable) + this->_buckets.size() * sizeof(uint32_t) + this->_texts.size() +
+           this->_values.size() * sizeof(uint16_t) + this->_valueData.size();
+  }
+
+  /// @brief  Write the table as C++ source, defining a MinuStringTable called \a name and the arrays it points to
+  /// @return false, if the file could not be written
+  bool write(FILE *file, const char *name) const
+  {
+    fprintf(file, "static const uint32_t %sBuckets[] = {", name);
+    for (size_t i = 0; i < this->_buckets.size(); ++i)
+      fprintf(file, "%s%u,", (i % 12) ? " " : "\n  ", this->_buckets[i]);
+    fprintf(file, "\n};\n\nstatic const uint8_t %sTexts[] = {", name);
+    for (size_t i = 0; i < this->_texts.size(); ++i)
+      fprintf(file, "%s0x%02X,", (i % 16) ? " " : "\n  ", this->_texts[i]);
+    fprintf(file, "\n};\n\nstatic const uint16_t %sValues[] = {", name);
+    for (size_t i = 0; i < this->_values.size(); ++i)
+      fprintf(file, "%s%u,", (i % 12) ? " " : "\n  ", this->_values[i]);
+    fprintf(file, "\n};\n\nstatic const char %sValueData[] =", name);
+    for (size_t i = 0; i < this->_valueData.size(); i += strlen(&this->_valueData[i]) + 1)
+    {
+      // NULs are written as 3-digit octal escapes, so that a following digit is not taken as part of them
+      fprintf(file, "\n  \"");
+      for (const char *c = &this->_valueData[i]; *c; ++c)
+      {
+        if (*c == '"' || *c == '\\')
+          fputc('\\', file);
+        fputc(*c, file);
+      }
+      fprintf(file, "\\000\"");
+    }
+    fprintf(file, "%s;\n\n", (this->_valueData.empty()) ? " \"\"" : "");
+    fprintf(file, "static const MinuStringTable %s = {%u, %sBuckets, %sTexts, %u, %sValues, %sValueData};\n", name,
+            (unsigned)this->_count, name, name, (unsigned)this->_values.size(), name, name);
+    return !ferror(file);
+  }
+
+private:
+  /// @brief Returns the index of a value, adding it if it is new
+  uint16_t _valueIndex(const char *value)
+  {
+    if (!value)
+      return MINU_STRTAB_NO_VALUE;
+    for (size_t i = 0; i < this->_values.size(); ++i)
+      if (!strcmp(&this->_valueData[this->_values[i]], value))
+        return i;
+    if (this->_values.size() >= MINU_STRTAB_NO_VALUE || this->_valueData.size() + strlen(value) + 1 > 0xFFFF)
+      return MINU_STRTAB_NO_VALUE;
+
+    this->_values.push_back(this->_valueData.size());
+    this->_valueData.insert(this->_valueData.end(), value, value + strlen(value) + 1);
+    return this->_values.size() - 1;
+  }
+
+  size_t _count;
+  std::vector<uint32_t> _buckets;
+  std::vector<uint8_t> _texts;
+  std::vector<uint16_t> _values;
+  std::vector<char> _valueData;
+  std::vector<char> _last;
+};
+
+#endif
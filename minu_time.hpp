@@ -0,0 +1,272 @@
+/*
+ * @file  minu_time.hpp
+ * @brief Keeps the date and time formatted for display, and a hardware clock in sync with network time.
+ *
+ * A MinuTimeService reads the wall clock, which costs microseconds, and only formats the date and time again when the
+ * second changes. The text is written to the canvas cells and page items bound to it, so a time page only needs to
+ * call update() once per second. msToNextSecond() gives the time until the next second starts, so that the caller
+ * can wake up just after it rather than polling, e.g. with MinuEventLoop::addPageTimeout():
+ *
+ *   void timeTick(void *arg)
+ *   {
+ *     timeService.update();
+ *     uiLoop.addPageTimeout(timePageId, timeService.msToNextSecond(), timeTick);
+ *   }
+ *
+ * A sync callback, e.g. one copying network time to an RTC, can be run on a schedule or only when requested, e.g.
+ * from the SNTP time sync notification. requestSync() is safe to call from any task, and the callback is then run by
+ * the next call to update() or sync() on the task owning the service, so the notification never waits on the RTC.
+ */
+
+#ifndef _LIBMINU_TIME_H_
+#define _LIBMINU_TIME_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/time.h>
+#include <atomic>
+
+#include "minu.hpp"
+
+#define MINU_TIME_TEXT_LEN          32           // Longest formatted date or time, including the NUL
+#define MINU_TIME_BINDING_MAX       4            // Maximum number of canvas cells and items showing the date or time
+#define MINU_TIME_FORMAT_DEFAULT    "%H:%M:%S"
+#define MINU_DATE_FORMAT_DEFAULT    "%d/%m/%Y"
+#define MINU_TIME_UNSET_TEXT        "--"         // Shown until the clock is set
+#define MINU_TIME_VALID_AFTER       1577836800   // 2020-01-01. Earlier times mean the clock has not been set
+#define MINU_TIME_WAKE_MARGIN_MS    1            // Added to msToNextSecond(), so that the caller wakes up after the second
+
+/// @brief Fields of a MinuTimeService that can be bound to a canvas cell or an item
+enum MinuTimeField
+{
+  MINU_TIME_FIELD_TIME = 0,
+  MINU_TIME_FIELD_DATE,
+};
+
+/// @brief Wall clock of the C library, kept by SNTP on the ESP32
+class MinuWallClock
+{
+
+public:
+  void now(struct timeval &tv) { gettimeofday(&tv, NULL); }
+};
+
+/// @brief Formats the date and time once per second. See the top of this file for details.
+/// @note  All members must be called from the same task, e.g. the loop task, except requestSync()
+template <class WallClock = MinuWallClock>
+class MinuTimeService
+{
+
+public:
+  MinuTimeService(const char *timeFormat = MINU_TIME_FORMAT_DEFAULT, const char *dateFormat = MINU_DATE_FORMAT_DEFAULT)
+  {
+    this->_timeFormat = timeFormat;
+    this->_dateFormat = dateFormat;
+    this->_seconds = 0;
+    this->_nextMs = 0;
+    this->_formatted = false;
+    this->_bindingCount = 0;
+    this->_syncCb = NULL;
+    this->_syncArg = NULL;
+    this->_syncIntervalS = 0;
+    this->_lastSync = 0;
+    this->_syncCount = 0;
+    this->_syncRequested.store(false);
+    strcpy(this->_time, MINU_TIME_UNSET_TEXT);
+    strcpy(this->_date, MINU_TIME_UNSET_TEXT);
+  }
+
+  /// @brief Set the strftime() formats of the time and the date
+  /// @note  The strings are not copied
+  void setFormats(const char *timeFormat, const char *dateFormat)
+  {
+    this->_timeFormat = timeFormat;
+    this->_dateFormat = dateFormat;
+    this->_formatted = false;
+  }
+
+  /// @brief Set the POSIX timezone the time is shown in, e.g. "CET-1CEST,M3.5.0,M10.5.0/3"
+  void setTimezone(const char *tz)
+  {
+    if (!tz)
+      return;
+    setenv("TZ", tz, 1);
+    tzset();
+    this->_formatted = false;
+  }
+
+  /// @brief  Show a field in the cells of a canvas, starting at the given cell
+  /// @return false, if there are already MINU_TIME_BINDING_MAX bindings
+  bool bindCanvas(MinuTextCanvas &canvas, uint16_t col, uint16_t row, uint8_t field)
+  {
+    if (this->_bindingCount >= MINU_TIME_BINDING_MAX)
+      return false;
+    Binding binding = {&canvas, NULL, col, row, field, false, 0};
+    this->_bindings[this->_bindingCount++] = binding;
+    this->_formatted = false;
+    return true;
+  }
+
+  /// @brief  Show a field as the main or auxiliary text of an item
+  /// @return false, if there are already MINU_TIME_BINDING_MAX bindings
+  bool bindItem(MinuPageItem &item, bool aux, uint8_t field)
+  {
+    if (this->_bindingCount >= MINU_TIME_BINDING_MAX)
+      return false;
+    Binding binding = {NULL, &item, 0, 0, field, aux, 0};
+    this->_bindings[this->_bindingCount++] = binding;
+    this->_formatted = false;
+    return true;
+  }
+
+  /// @brief Remove all bindings
+  void unbindAll(void) { this->_bindingCount = 0; }
+
+  /// @brief Set the function run to sync a clock, e.g. an RTC, with the wall clock
+  /// @param cb        Function to run, from update() or sync()
+  /// @param arg       Argument passed to \a cb
+  /// @param intervalS Interval between syncs, or 0 to only sync when requestSync() is called
+  void setSyncCallback(MinuCallbackFunction cb, void *arg = NULL, uint32_t intervalS = 0)
+  {
+    this->_syncCb = cb;
+    this->_syncArg = arg;
+    this->_syncIntervalS = intervalS;
+  }
+
+  /// @brief Have the sync callback run by the next call to update() or sync()
+  /// @note  Safe to call from any task, e.g. from the SNTP time sync notification
+  void requestSync(void) { this->_syncRequested.store(true); }
+
+  /// @brief  Run the sync callback, if it was requested or is due
+  /// @return true, if it was run
+  bool sync(void)
+  {
+    struct timeval tv;
+    this->_clock.now(tv);
+    return this->_sync(tv);
+  }
+
+  /// @brief  Read the wall clock, run the sync callback if it was requested or is due, and format the date and time
+  ///         again if the second changed, writing them to the bound canvas cells and items
+  /// @param  force Whether to format and write them even if the second did not change, e.g. once a page is opened
+  /// @return true, if the text changed. Items bound then need to be rendered again; canvas changes are printed by
+  ///         the event loop
+  bool update(bool force = false)
+  {
+    struct timeval tv;
+    this->_clock.now(tv);
+    this->_sync(tv);
+    this->_nextMs = 1000 - tv.tv_usec / 1000 + MINU_TIME_WAKE_MARGIN_MS;
+    if (!force && this->_formatted && tv.tv_sec == this->_seconds)
+      return false;
+
+    this->_seconds = tv.tv_sec;
+    this->_formatted = true;
+    if (this->valid())
+    {
+      struct tm local;
+      time_t seconds = tv.tv_sec;
+      localtime_r(&seconds, &local);
+      if (!strftime(this->_time, sizeof(this->_time), this->_timeFormat, &local))
+        this->_time[0] = 0;
+      if (!strftime(this->_date, sizeof(this->_date), this->_dateFormat, &local))
+        this->_date[0] = 0;
+    }
+    else
+    {
+      strcpy(this->_time, MINU_TIME_UNSET_TEXT);
+      strcpy(this->_date, MINU_TIME_UNSET_TEXT);
+    }
+
+    for (size_t i = 0; i < this->_bindingCount; ++i)
+      this->_write(this->_bindings[i]);
+    return true;
+  }
+
+  /// @brief Returns the time until the next second starts, as of the last call to update()
+  uint32_t msToNextSecond() const { return this->_nextMs; }
+
+  /// @brief Returns the formatted time, as of the last call to update()
+  const char *timeText() const { return this->_time; }
+
+  /// @brief Returns the formatted date, as of the last call to update()
+  const char *dateText() const { return this->_date; }
+
+  /// @brief Returns the seconds since the epoch, as of the last call to update()
+  time_t seconds() const { return this->_seconds; }
+
+  /// @brief Whether the wall clock has been set, as of the last call to update()
+  bool valid() const { return this->_seconds >= MINU_TIME_VALID_AFTER; }
+
+  /// @brief Returns the number of times the sync callback was run
+  uint32_t syncCount() const { return this->_syncCount; }
+
+private:
+  struct Binding
+  {
+    MinuTextCanvas *canvas;
+    MinuPageItem *item;
+    uint16_t col;
+    uint16_t row;
+    uint8_t field;
+    bool aux;
+    uint16_t len; // Characters written to the canvas last time, so that leftovers of a longer text are cleared
+  };
+
+  bool _sync(const struct timeval &tv)
+  {
+    // Scheduled syncs wait for the wall clock to be set, so that an RTC is not set to 1970
+    bool due = this->_syncIntervalS && tv.tv_sec >= MINU_TIME_VALID_AFTER &&
+               (uint32_t)(tv.tv_sec - this->_lastSync) >= this->_syncIntervalS;
+    if (!this->_syncCb || !(this->_syncRequested.exchange(false) || due))
+      return false;
+
+    this->_lastSync = tv.tv_sec;
+    this->_syncCount++;
+    this->_syncCb(this->_syncArg);
+    return true;
+  }
+
+  void _write(Binding &binding)
+  {
+    const char *text = (binding.field == MINU_TIME_FIELD_DATE) ? this->_date : this->_time;
+    if (binding.item)
+    {
+      if (binding.aux)
+        binding.item->setAuxText(text);
+      else
+        binding.item->setMainText(text);
+      return;
+    }
+
+    char padded[MINU_TIME_TEXT_LEN];
+    size_t len = strlen(text);
+    memcpy(padded, text, len);
+    while (len < binding.len && len < sizeof(padded) - 1)
+      padded[len++] = ' ';
+    padded[len] = 0;
+    binding.canvas->print(binding.col, binding.row, padded);
+    binding.len = strlen(text);
+  }
+
+  WallClock _clock;
+  const char *_timeFormat;
+  const char *_dateFormat;
+  char _time[MINU_TIME_TEXT_LEN];
+  char _date[MINU_TIME_TEXT_LEN];
+  time_t _seconds;
+  uint32_t _nextMs;
+  bool _formatted;
+  Binding _bindings[MINU_TIME_BINDING_MAX];
+  size_t _bindingCount;
+  MinuCallbackFunction _syncCb;
+  void *_syncArg;
+  uint32_t _syncIntervalS;
+  time_t _lastSync;
+  uint32_t _syncCount;
+  std::atomic<bool> _syncRequested;
+};
+
+#endif
@@ -0,0 +1,349 @@
+/*
+ * @file  minu_timer.hpp
+ * @brief Hierarchical timer wheel that runs periodic and one-shot updaters for Minu pages from a single task.
+ *
+ * Rather than each page that shows live data creating a task of its own while it is open, pages register updaters
+ * with a MinuTimerWheel, e.g. the one owned by MinuEventLoop, and all of them are run from the task that advances it.
+ *
+ * Timers are kept in MINU_TIMER_WHEEL_LEVELS wheels of MINU_TIMER_WHEEL_SLOTS slots. The first wheel has one slot
+ * per tick of MINU_TIMER_TICK_MS, and each slot of the next wheel spans a whole turn of the previous one. Adding,
+ * removing and expiring a timer is constant time; timers in the outer wheels are moved inwards as their slot comes
+ * round. Timers further out than the outermost wheel are parked in it and moved again until they are due.
+ *
+ * A timer may be given a slack, the time by which it may fire late. Its expiry is then rounded to the tick with the
+ * most trailing zero bits within that window, so that timers with similar slack tend to fire on the same tick and
+ * the task running them wakes up less often.
+ *
+ * A timer may also be bound to a page, in which case it is cancelled once setVisiblePage() is called with another
+ * page, i.e. once its page is closed.
+ */
+
+#ifndef _LIBMINU_TIMER_H_
+#define _LIBMINU_TIMER_H_
+
+#include <stdint.h>
+
+#include "minu.hpp"
+
+#define MINU_TIMER_MAX              16          // Maximum number of timers
+#define MINU_TIMER_TICK_MS          10          // Resolution of the timers
+#define MINU_TIMER_WHEEL_BITS       5           // log2 of the number of slots in each wheel
+#define MINU_TIMER_WHEEL_SLOTS      (1 << MINU_TIMER_WHEEL_BITS)
+#define MINU_TIMER_WHEEL_LEVELS     3           // Number of wheels. 3 wheels of 32 slots span 327s at 10ms ticks
+#define MINU_TIMER_WAIT_FOREVER     0xFFFFFFFF  // Returned when no timer is running
+#define MINU_TIMER_NO_PAGE          -1          // Page of a timer that runs regardless of the current page
+
+/// @brief Hierarchical timer wheel. See the top of this file for details.
+/// @note  All members must be called from the same task
+class MinuTimerWheel
+{
+
+public:
+  MinuTimerWheel()
+  {
+    this->_base = 0;
+    this->_next = 1;
+    this->_count = 0;
+    this->_visiblePage = MINU_TIMER_NO_PAGE;
+    for (size_t i = 0; i < LIST_COUNT; ++i)
+      this->_heads[i] = NIL;
+    for (size_t i = 0; i < MINU_TIMER_MAX; ++i)
+    {
+      this->_timers[i].cb = NULL;
+      this->_timers[i].generation = 0;
+      this->_timers[i].list = NIL;
+    }
+  }
+
+  /// @brief Set the time the wheel starts counting from
+  /// @param now Current time in milliseconds
+  void begin(uint32_t now) { this->_base = now; }
+
+  /// @brief  Add a timer
+  /// @param  now      Current time in milliseconds
+  /// @param  delayMs  Time until the first call
+  /// @param  periodMs Interval between the following calls, or 0 to only call once
+  /// @param  slackMs  Time by which each call may be late, so that it can be made together with others
+  /// @param  cb       Function to call
+  /// @param  arg      Argument passed to \a cb
+  /// @param  pageId   Page the timer is bound to, or MINU_TIMER_NO_PAGE
+  /// @return Handle used to remove the timer, or -1 if no timers are free
+  ssize_t add(uint32_t now, uint32_t delayMs, uint32_t periodMs, uint32_t slackMs, MinuCallbackFunction cb,
+              void *arg = NULL, ssize_t pageId = MINU_TIMER_NO_PAGE)
+  {
+    if (!cb)
+      return -1;
+
+    for (size_t i = 0; i < MINU_TIMER_MAX; ++i)
+    {
+      Timer &t = this->_timers[i];
+      if (t.cb)
+        continue;
+
+      t.cb = cb;
+      t.arg = arg;
+      t.period = _ticks(periodMs);
+      t.slack = slackMs / MINU_TIMER_TICK_MS;
+      t.pageId = pageId;
+      t.generation++;
+      this->_count++;
+
+      // The current tick is partly over, so round up from its start
+      t.due = this->_next - 1 + _ticks((now - this->_base) + delayMs);
+      this->_schedule(i);
+      return (ssize_t)t.generation << 8 | i;
+    }
+    return -1;
+  }
+
+  /// @brief Remove a timer. Handles of timers that already finished or were cancelled are ignored
+  /// @param handle Handle returned by add()
+  void remove(ssize_t handle)
+  {
+    size_t i = handle & 0xFF;
+    if (handle < 0 || i >= MINU_TIMER_MAX)
+      return;
+
+    Timer &t = this->_timers[i];
+    if (t.cb && t.generation == (uint16_t)(handle >> 8))
+      this->_free(i);
+  }
+
+  /// @brief Cancel the timers bound to pages other than \a pageId
+  void setVisiblePage(ssize_t pageId)
+  {
+    if (pageId == this->_visiblePage)
+      return;
+
+    this->_visiblePage = pageId;
+    for (size_t i = 0; i < MINU_TIMER_MAX; ++i)
+    {
+      Timer &t = this->_timers[i];
+      if (t.cb && t.pageId != MINU_TIMER_NO_PAGE && t.pageId != pageId)
+        this->_free(i);
+    }
+  }
+
+  /// @brief  Call the timers that are due
+  /// @param  now Current time in milliseconds
+  /// @return Number of timers called
+  size_t advance(uint32_t now)
+  {
+    uint32_t ticks = (now - this->_base) / MINU_TIMER_TICK_MS;
+    this->_base += ticks * MINU_TIMER_TICK_MS;
+
+    // With no timers, there is nothing to move between the wheels either
+    if (!this->_count)
+    {
+      this->_next += ticks;
+      return 0;
+    }
+
+    size_t called = 0;
+    while (ticks--)
+    {
+      uint32_t tick = this->_next;
+      size_t index = tick & SLOT_MASK;
+      for (size_t level = 1; !index && level < MINU_TIMER_WHEEL_LEVELS; ++level)
+      {
+        index = (tick >> (level * MINU_TIMER_WHEEL_BITS)) & SLOT_MASK;
+        this->_cascade(level * MINU_TIMER_WHEEL_SLOTS + index);
+      }
+
+      // Timers added or rescheduled while calling these cannot be due before the next tick
+      this->_next++;
+      this->_move(tick & SLOT_MASK, RUNNING);
+      while (this->_heads[RUNNING] != NIL)
+      {
+        size_t i = this->_heads[RUNNING];
+        Timer &t = this->_timers[i];
+        this->_unlink(i);
+
+        if (t.pageId != MINU_TIMER_NO_PAGE && t.pageId != this->_visiblePage)
+        {
+          this->_free(i);
+          continue;
+        }
+
+        // Periodic timers are scheduled relative to when they were due to avoid drift, unless a whole period was missed
+        MinuCallbackFunction cb = t.cb;
+        void *arg = t.arg;
+        uint16_t generation = t.generation;
+        if (t.period)
+        {
+          t.due += t.period;
+          if ((int32_t)(t.due - this->_next) < 0)
+            t.due = this->_next - 1 + t.period;
+          this->_schedule(i);
+        }
+        cb(arg);
+        called++;
+
+        // A one-shot timer is only freed once it has been called, unless it was removed or replaced by then
+        if (!t.period && t.cb && t.generation == generation)
+          this->_free(i);
+      }
+    }
+    return called;
+  }
+
+  /// @brief  Returns the number of milliseconds until the next timer is due
+  /// @param  now Current time in milliseconds
+  uint32_t timeout(uint32_t now) const
+  {
+    if (!this->_count)
+      return MINU_TIMER_WAIT_FOREVER;
+
+    // Each wheel's slots cover consecutive ranges of time, so the earliest timer of a wheel is in the first
+    // non-empty slot after the current one. Moving timers between wheels is left to advance()
+    uint32_t ticks = 0;
+    for (size_t level = 0; level < MINU_TIMER_WHEEL_LEVELS; ++level)
+    {
+      size_t shift = level * MINU_TIMER_WHEEL_BITS;
+      uint32_t first = (this->_next + ((uint32_t)1 << shift) - 1) >> shift;
+      for (uint32_t s = 0; s < MINU_TIMER_WHEEL_SLOTS; ++s)
+      {
+        int16_t i = this->_heads[level * MINU_TIMER_WHEEL_SLOTS + ((first + s) & SLOT_MASK)];
+        for (; i != NIL; i = this->_timers[i].next)
+        {
+          int32_t delta = (int32_t)(this->_expiry(this->_timers[i]) - this->_next);
+          uint32_t candidate = (delta > 0) ? delta + 1 : 1;
+          if (!ticks || candidate < ticks)
+            ticks = candidate;
+        }
+        if (ticks)
+          break;
+      }
+    }
+
+    int32_t remaining = (int32_t)(this->_base + ticks * MINU_TIMER_TICK_MS - now);
+    return (remaining > 0) ? remaining : 0;
+  }
+
+  /// @brief Returns the number of timers running
+  size_t count() const { return this->_count; }
+
+private:
+  static const int16_t NIL = -1;
+  static const size_t SLOT_MASK = MINU_TIMER_WHEEL_SLOTS - 1;
+  static const size_t RUNNING = MINU_TIMER_WHEEL_LEVELS * MINU_TIMER_WHEEL_SLOTS;
+  static const size_t LIST_COUNT = RUNNING + 1;
+
+  struct Timer
+  {
+    MinuCallbackFunction cb;
+    void *arg;
+    uint32_t due;
+    uint32_t period;
+    uint32_t slack;
+    ssize_t pageId;
+    uint16_t generation;
+    int16_t list;
+    int16_t prev;
+    int16_t next;
+  };
+
+  static uint32_t _ticks(uint32_t ms) { return (ms + MINU_TIMER_TICK_MS - 1) / MINU_TIMER_TICK_MS; }
+
+  /// @brief Returns the tick a timer fires on, i.e. the tick within its slack with the most trailing zero bits
+  static uint32_t _expiry(const Timer &t)
+  {
+    if (!t.slack)
+      return t.due;
+
+    // Clear the low bits in which the earliest and latest acceptable expiry differ
+    uint32_t latest = t.due + t.slack;
+    uint32_t mask = latest ^ t.due;
+    uint32_t bit = 0;
+    while (mask >> bit)
+      bit++;
+    if (bit <= 1)
+      return t.due;
+    return latest & ~(((uint32_t)1 << (bit - 1)) - 1);
+  }
+
+  /// @brief Put a timer into the slot its expiry falls in
+  void _schedule(size_t i)
+  {
+    uint32_t expires = this->_expiry(this->_timers[i]);
+    uint32_t delta = expires - this->_next;
+    if ((int32_t)delta < 0)
+    {
+      expires = this->_next;
+      delta = 0;
+    }
+
+    size_t level = 0;
+    while (level < MINU_TIMER_WHEEL_LEVELS - 1 && delta >= ((uint32_t)1 << ((level + 1) * MINU_TIMER_WHEEL_BITS)))
+      level++;
+
+    // Beyond the outermost wheel, park the timer in its furthest slot
+    uint32_t range = (uint32_t)1 << (MINU_TIMER_WHEEL_LEVELS * MINU_TIMER_WHEEL_BITS);
+    if (delta >= range)
+      expires = this->_next + range - 1;
+
+    this->_link(i, level * MINU_TIMER_WHEEL_SLOTS + ((expires >> (level * MINU_TIMER_WHEEL_BITS)) & SLOT_MASK));
+  }
+
+  /// @brief Move the timers of an outer slot to where they now belong
+  void _cascade(size_t list)
+  {
+    this->_move(list, RUNNING);
+    while (this->_heads[RUNNING] != NIL)
+    {
+      size_t i = this->_heads[RUNNING];
+      this->_unlink(i);
+      this->_schedule(i);
+    }
+  }
+
+  void _move(size_t from, size_t to)
+  {
+    this->_heads[to] = this->_heads[from];
+    this->_heads[from] = NIL;
+    for (int16_t i = this->_heads[to]; i != NIL; i = this->_timers[i].next)
+      this->_timers[i].list = to;
+  }
+
+  void _link(size_t i, size_t list)
+  {
+    Timer &t = this->_timers[i];
+    t.list = list;
+    t.prev = NIL;
+    t.next = this->_heads[list];
+    if (t.next != NIL)
+      this->_timers[t.next].prev = i;
+    this->_heads[list] = i;
+  }
+
+  void _unlink(size_t i)
+  {
+    Timer &t = this->_timers[i];
+    if (t.list == NIL)
+      return;
+
+    if (t.prev != NIL)
+      this->_timers[t.prev].next = t.next;
+    else
+      this->_heads[t.list] = t.next;
+    if (t.next != NIL)
+      this->_timers[t.next].prev = t.prev;
+    t.list = NIL;
+  }
+
+  void _free(size_t i)
+  {
+    this->_unlink(i);
+    this->_timers[i].cb = NULL;
+    this->_count--;
+  }
+
+  uint32_t _base;
+  uint32_t _next;
+  size_t _count;
+  ssize_t _visiblePage;
+  int16_t _heads[LIST_COUNT];
+  Timer _timers[MINU_TIMER_MAX];
+};
+
+#endif